@@ -0,0 +1,83 @@
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+// Minimal benchmark runner for the host build.
+// Reports wall-clock cost per operation on the host CPU; firmware code is
+// silenced while timing so Serial output does not skew the numbers.
+
+#include <Arduino.h>
+#include <chrono>
+#include <cstdio>
+
+struct BenchResult {
+  const char* name;
+  unsigned long iterations;
+  double nsPerOp;
+};
+
+// Keep the optimizer from discarding benchmark results
+template <typename T>
+inline void benchKeep(const T& value) {
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+template <typename Fn>
+BenchResult runBench(const char* name, unsigned long iterations, Fn fn) {
+  Serial.setMuted(true);
+
+  // Warm-up pass
+  for (unsigned long i = 0; i < iterations / 10 + 1; i++) fn(i);
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned long i = 0; i < iterations; i++) fn(i);
+  auto end = std::chrono::steady_clock::now();
+
+  Serial.setMuted(false);
+
+  double ns = std::chrono::duration<double, std::nano>(end - start).count();
+  BenchResult result = {name, iterations, ns / iterations};
+  printf("  %-36s %12.1f ns/op  (%lu iters)\n", name, result.nsPerOp, iterations);
+  return result;
+}
+
+// Charges the host CPU time of its scope to the virtual clock, so timers in a
+// simulation see firmware compute (at host speed) as well as bus and wire
+// time. Declare it after a ScopedStageTimer in the same scope, so the charge
+// lands before the timer reads the clock. Sub-microsecond remainders carry
+// over to the next scope.
+class ChargedCompute {
+private:
+  static inline double carryNs = 0;
+  std::chrono::steady_clock::time_point start;
+
+public:
+  ChargedCompute() : start(std::chrono::steady_clock::now()) {}
+
+  ~ChargedCompute() {
+    carryNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    uint64_t us = (uint64_t)(carryNs / 1000.0);
+    carryNs -= us * 1000.0;
+    HostClock::advanceMicros(us);
+  }
+};
+
+// Pass/fail counter for the host checks
+struct CheckTally {
+  int passed = 0;
+  int failed = 0;
+
+  void expect(bool condition, const char* what) {
+    if (condition) {
+      passed++;
+    } else {
+      failed++;
+      printf("  FAIL: %s\n", what);
+    }
+  }
+};
+
+inline void benchSection(const char* title) {
+  printf("\n== %s ==\n", title);
+}
+
+#endif // BENCH_HARNESS_H
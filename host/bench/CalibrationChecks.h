@@ -0,0 +1,173 @@
+#ifndef CALIBRATION_CHECKS_H
+#define CALIBRATION_CHECKS_H
+
+// Host checks for the gyro offset calibration: IMU traces with a zero-rate
+// offset that drifts with die temperature, replayed through fresh MPUSensor
+// instances (a reboot each) sharing the host flash. Covers the startup
+// calibration, using the stored offset while moving after a reboot, tracking
+// a 15-degree warm-up, and what the lower rotation threshold does at rest and
+// on a slow spin.
+
+#include <cmath>
+#include <Preferences.h>
+#include "hardware/MPUSensor.h"
+#include "motion/GestureDetector.h"
+#include "sim/MPU6050Model.h"
+#include "sim/ImuTraces.h"
+#include "OrientationChecks.h"
+#include "BenchHarness.h"
+
+namespace CalibrationChecks {
+  // Worst offset error over the three axes at the trace's current temperature
+  inline float offsetError(const MPUSensor& sensor, const ImuTrace& trace) {
+    float worst = 0;
+    for (int axis = 0; axis < 3; axis++) {
+      float learned = sensor.getCalibration().getOffset(axis, sensor.getTemperature());
+      worst = max(worst, fabsf(learned - trace.getGyroOffset(axis)));
+    }
+    return worst;
+  }
+
+  // Rocked back and forth about X, never still
+  inline void wobble(ImuTrace& trace, float seconds) {
+    for (float t = 0; t < seconds; t += 0.5f) {
+      trace.rotate(40, 0, 0, 0.25f);
+      trace.rotate(-40, 0, 0, 0.25f);
+    }
+  }
+
+  // Power-up with the die at the trace's starting temperature
+  inline void powerUp(MPUSensor& sensor, MPU6050Model& model, const ImuTrace& trace) {
+    model.setTemperature(trace.getSamples().front().temperature);
+    sensor.begin();
+  }
+
+  inline void configure(ImuTrace& trace, float temperature, float rate) {
+    trace.setGyroOffset(8.0f, -6.0f, 12.0f);
+    trace.setGyroOffsetSlope(0.06f, -0.04f, 0.08f);
+    trace.setTemperature(temperature, rate);
+  }
+}
+
+inline void verifyGyroCalibration(MPU6050Model& model) {
+  using namespace CalibrationChecks;
+  using OrientationChecks::Replay;
+  benchSection("Gyro offset calibration (IMU trace replay, reboots)");
+  CheckTally tally;
+
+  Serial.setMuted(true);
+  model.setAutoSample(false);
+  model.clearFifo();
+  HostFlash::erase();
+  unsigned long writesBefore = HostFlash::writes;
+  Replay result;
+
+  // First boot, 3 s on the table at 30 C
+  ImuTrace boot(11);
+  configure(boot, 30, 0);
+  boot.hold(3);
+  float firstBootError;
+  GyroCalibration::State firstBootState;
+  {
+    MPUSensor sensor(-1);
+    GestureDetector gestures;
+    powerUp(sensor, model, boot);
+    tally.expect(sensor.getCalibration().getState() == GyroCalibration::State::UNCALIBRATED,
+                 "first boot has no stored offset");
+    OrientationChecks::replay(sensor, model, gestures, boot, result);
+    firstBootError = offsetError(sensor, boot);
+    firstBootState = sensor.getCalibration().getState();
+  }
+  tally.expect(firstBootState == GyroCalibration::State::CALIBRATED && firstBootError < 0.05f,
+               "startup calibration within 0.05 dps");
+  tally.expect(HostFlash::writes - writesBefore == 1, "offset saved once after calibrating");
+
+  // Reboot while being handled: the stored offset keeps rotations honest
+  ImuTrace handled(12);
+  configure(handled, 30, 0);
+  wobble(handled, 5);
+  float handledDrift, handledError;
+  GyroCalibration::State handledState;
+  {
+    MPUSensor sensor(-1);
+    GestureDetector gestures;
+    powerUp(sensor, model, handled);
+    OrientationChecks::replay(sensor, model, gestures, handled, result);
+    handledDrift = fabsf(result.rotationX);
+    handledError = offsetError(sensor, handled);
+    handledState = sensor.getCalibration().getState();
+  }
+  float handledUncalibrated = handled.getGyroOffset(0) * 5;
+  tally.expect(handledState == GyroCalibration::State::STORED && handledError < 0.05f,
+               "moving after a reboot uses the stored offset");
+  tally.expect(handledDrift < 1, "no rotation drift while handled");
+
+  // Warm-up, 30 -> 45 C over 15 min: 20 s at rest, 10 s of slow spin, ...
+  ImuTrace warmup(13);
+  configure(warmup, 30, 15.0f / 900);
+  warmup.hold(3);
+  for (int cycle = 0; cycle < 30; cycle++) {
+    warmup.hold(20);
+    warmup.rotate(0, 0, cycle & 1 ? -30 : 30, 10);
+  }
+  warmup.rotate(0, 0, 30, 10);
+  float warmError, slopeError = 0;
+  unsigned long rejected;
+  {
+    MPUSensor sensor(-1);
+    GestureDetector gestures;
+    powerUp(sensor, model, warmup);
+    OrientationChecks::replay(sensor, model, gestures, warmup, result);
+    warmError = offsetError(sensor, warmup);
+    const float slopes[3] = {0.06f, -0.04f, 0.08f};
+    for (int axis = 0; axis < 3; axis++) {
+      slopeError = max(slopeError, fabsf(sensor.getCalibration().getSlope(axis) - slopes[axis]));
+    }
+    rejected = sensor.getCalibration().getRejectedBlocks();
+  }
+  tally.expect(slopeError < 0.015f, "temperature slope learned");
+  tally.expect(warmError < 0.15f, "offset follows the warm-up while spinning");
+  tally.expect(rejected > 0, "steady spins are not taken for offset");
+
+  // At rest for two minutes, then a slow 390-degree spin
+  ImuTrace rest(14);
+  configure(rest, 35, 0);
+  rest.hold(3);
+  rest.hold(120);
+  ImuTrace slowSpin(15);
+  configure(slowSpin, 35, 0);
+  slowSpin.rotate(0, 0, 30, 13);
+  slowSpin.hold(2);
+  float restDrift;
+  int restTriggers, spinTriggers;
+  {
+    MPUSensor sensor(-1);
+    GestureDetector gestures;
+    powerUp(sensor, model, rest);
+    OrientationChecks::replay(sensor, model, gestures, rest, result);
+    restDrift = max(fabsf(result.rotationX), fabsf(result.rotationZ));
+    restTriggers = result.xRotations + result.zRotations;
+    OrientationChecks::replay(sensor, model, gestures, slowSpin, result);
+    spinTriggers = result.zRotations;
+  }
+  tally.expect(restTriggers == 0, "no rotation triggers at rest");
+  tally.expect(restDrift < 5, "under 5 degrees of drift in two minutes at rest");
+  tally.expect(spinTriggers == 1, "30 dps spin triggers once");
+  unsigned long flashWrites = HostFlash::writes - writesBefore;
+
+  model.setAutoSample(true);
+  model.clearFifo();
+  Serial.setMuted(false);
+
+  printf("  first boot            offset error %.3f dps after 3 s at rest\n", firstBootError);
+  printf("  reboot while handled  offset error %.3f dps, drift %.2f deg in 5 s (uncalibrated: %.0f deg)\n",
+         handledError, handledDrift, handledUncalibrated);
+  printf("  warm-up 30 -> 45 C    slope error %.4f dps/C, offset error %.3f dps, %lu spin blocks ignored\n",
+         slopeError, warmError, rejected);
+  printf("  2 min at rest         drift %.2f deg, %d triggers; 30 dps spin: %d trigger(s)\n",
+         restDrift, restTriggers, spinTriggers);
+  printf("  flash writes          %lu\n", flashWrites);
+  printf("  %d passed, %d failed\n", tally.passed, tally.failed);
+}
+
+#endif // CALIBRATION_CHECKS_H
@@ -0,0 +1,292 @@
+#ifndef COMMAND_PARSER_CHECKS_H
+#define COMMAND_PARSER_CHECKS_H
+
+// Host checks for CommandParser: fixed regressions (prefix shadowing,
+// whitespace, value parsing, serial line assembly), a fuzz run comparing
+// dispatch against a std::string reference parser on random and mutated
+// input, and CommandQueue batches pushed from a second thread.
+
+#include <string>
+#include <thread>
+#include "control/CommandParser.h"
+#include "control/CommandQueue.h"
+#include "BenchHarness.h"
+
+namespace ParserChecks {
+  // Same names as setupCommands() in src/main.cpp
+  const char* const NAMES[] = {"tap", "reset", "battery", "threshold", "brightness", "palette",
+                               "pattern", "bpm", "leds", "sensor", "tasks", "stats", "dither", "help"};
+  const int NAME_COUNT = sizeof(NAMES) / sizeof(NAMES[0]);
+
+  int lastIndex = -1;
+  std::string lastValue;
+  int dispatches = 0;
+
+  template <int Index>
+  void record(const CommandText& value) {
+    lastIndex = Index;
+    lastValue.assign(value.data, value.length);
+    dispatches++;
+  }
+
+  Command commands[] = {
+    {NAMES[0], record<0>}, {NAMES[1], record<1>}, {NAMES[2], record<2>},
+    {NAMES[3], record<3>}, {NAMES[4], record<4>}, {NAMES[5], record<5>},
+    {NAMES[6], record<6>}, {NAMES[7], record<7>}, {NAMES[8], record<8>},
+    {NAMES[9], record<9>}, {NAMES[10], record<10>}, {NAMES[11], record<11>},
+    {NAMES[12], record<12>}, {NAMES[13], record<13>},
+  };
+
+  std::string trim(const std::string& text) {
+    size_t start = 0;
+    size_t end = text.size();
+    while (start < end && isspace((unsigned char)text[start])) start++;
+    while (end > start && isspace((unsigned char)text[end - 1])) end--;
+    return text.substr(start, end - start);
+  }
+
+  // Reference: command index (or -1) and value for `input`
+  int referenceParse(const std::string& input, std::string& value) {
+    std::string text = trim(input);
+    std::string name = text;
+    value.clear();
+    size_t equals = text.find('=');
+    if (equals != std::string::npos && equals > 0) {
+      name = trim(text.substr(0, equals));
+      value = trim(text.substr(equals + 1));
+    }
+    if (text.empty()) return -1;
+    for (int i = 0; i < NAME_COUNT; i++) {
+      if (name == NAMES[i]) return i;
+    }
+    return -1;
+  }
+
+  bool dispatchesAs(CommandParser& parser, const std::string& input, int index, const std::string& value) {
+    lastIndex = -1;
+    lastValue.clear();
+    bool handled = parser.parse(input.data(), input.size());
+    return handled == (index >= 0) && lastIndex == index && (index < 0 || lastValue == value);
+  }
+
+  std::string mutate(std::string text) {
+    int edits = random(1, 4);
+    for (int e = 0; e < edits; e++) {
+      int at = text.empty() ? 0 : random(0, (long)text.size() + 1);
+      switch (random(0, 6)) {
+        case 0: text.insert(at, 1, (char)random(0, 256)); break;
+        case 1: if (!text.empty() && at < (int)text.size()) text.erase(at, 1); break;
+        case 2: if (at < (int)text.size()) text[at] = (char)random(32, 127); break;
+        case 3: text.insert(at, random(0, 2) ? " " : "\t"); break;
+        case 4: text = text.substr(0, at); break;                   // Truncate ("bright", "b")
+        case 5: if (at < (int)text.size()) text[at] = toupper(text[at]); break;
+      }
+    }
+    return text;
+  }
+}
+
+inline void checkParserRegressions(CheckTally& tally, CommandParser& parser) {
+  using namespace ParserChecks;
+
+  tally.expect(dispatchesAs(parser, "brightness=0.5", 4, "0.5"), "name=value dispatch");
+  tally.expect(dispatchesAs(parser, "  brightness = 0.5 \r\n", 4, "0.5"), "whitespace around name and value");
+  tally.expect(dispatchesAs(parser, "b", -1, ""), "\"b\" no longer matches a b... command");
+  tally.expect(dispatchesAs(parser, "bright=0.5", -1, ""), "prefix of a name is unknown");
+  tally.expect(dispatchesAs(parser, "brightnessX=1", -1, ""), "name with trailing text is unknown");
+  tally.expect(dispatchesAs(parser, "bpm", 7, ""), "bpm is not shadowed by brightness/battery");
+  tally.expect(dispatchesAs(parser, "=5", -1, ""), "missing name is unknown");
+  tally.expect(dispatchesAs(parser, "pattern=", 6, ""), "empty value");
+  tally.expect(dispatchesAs(parser, "palette=a=b", 5, "a=b"), "value keeps later '='");
+  tally.expect(!parser.parse(""), "empty input is ignored");
+  tally.expect(parser.isKnown(" bpm = 120") && !parser.isKnown("bright=1") && !parser.isKnown(""),
+               "isKnown agrees with dispatch");
+
+  float f = 0;
+  int n = 0;
+  tally.expect(CommandParser::parseFloat("0.25", f, 0.1f, 1.0f) && f == 0.25f, "parseFloat in range");
+  tally.expect(!CommandParser::parseFloat("0.5abc", f, 0.1f, 1.0f), "parseFloat rejects trailing garbage");
+  tally.expect(!CommandParser::parseFloat("", f, 0.1f, 1.0f), "parseFloat rejects empty text");
+  tally.expect(CommandParser::parseInt("17", n, 0, 17) && n == 17, "parseInt at the upper bound");
+  tally.expect(!CommandParser::parseInt("18", n, 0, 17), "parseInt out of range");
+  tally.expect(CommandParser::parseBool("ON") && !CommandParser::parseBool("off"), "parseBool");
+  tally.expect(CommandParser::parseHexColor("#12ab34") == 0x12AB34, "parseHexColor");
+
+  // Serial: line endings, a pause ending a line, overlong input
+  dispatches = 0;
+  Serial.inject("tap\nbrightness=0.3\r\n");
+  parser.processSerial();
+  tally.expect(dispatches == 2 && lastIndex == 4 && lastValue == "0.3", "serial lines dispatch in order");
+
+  dispatches = 0;
+  Serial.inject("help");
+  parser.processSerial();
+  bool waited = dispatches == 0;
+  HostClock::advanceMillis(SystemConfig::SERIAL_COMMAND_IDLE_MS);
+  parser.processSerial();
+  tally.expect(waited && dispatches == 1 && lastIndex == 13, "serial line without newline ends on pause");
+
+  dispatches = 0;
+  std::string longLine(SystemConfig::COMMAND_MAX_LENGTH + 10, 'x');
+  Serial.inject(("tap" + longLine + "\ntap\n").c_str());
+  parser.processSerial();
+  tally.expect(dispatches == 1 && lastIndex == 0, "overlong serial line is dropped, next one runs");
+}
+
+inline void checkParserFuzz(CheckTally& tally, CommandParser& parser, unsigned long cases) {
+  using namespace ParserChecks;
+
+  unsigned long mismatches = 0;
+  unsigned long matched = 0;
+  std::string input;
+  std::string value;
+
+  for (unsigned long i = 0; i < cases; i++) {
+    if (i % 3 == 0) {
+      input.clear();
+      int length = random(0, 40);
+      for (int c = 0; c < length; c++) input += (char)random(0, 256);
+    } else {
+      input = NAMES[random(0, NAME_COUNT)];
+      if (random(0, 2)) input += "=" + std::to_string(random(0, 300));
+      input = mutate(input);
+    }
+
+    int expected = referenceParse(input, value);
+    if (expected >= 0) matched++;
+    if (!dispatchesAs(parser, input, expected, value)) {
+      if (mismatches++ < 3) printf("  mismatch on input of %zu bytes\n", input.size());
+    }
+  }
+
+  printf("  fuzz                  %lu inputs (%lu valid commands), %lu mismatches\n",
+         cases, matched, mismatches);
+  tally.expect(mismatches == 0, "fuzz: dispatch matches the reference parser");
+}
+
+namespace QueueChecks {
+  // Every batch sets all three to the same number
+  const char* const NAMES[] = {"threshold", "pattern", "bpm"};
+  long values[3];
+  unsigned long applied = 0;
+
+  template <int Index>
+  void store(const CommandText& value) {
+    value.toInt(values[Index]);
+    applied++;
+  }
+
+  Command commands[] = {{NAMES[0], store<0>}, {NAMES[1], store<1>}, {NAMES[2], store<2>}};
+
+  void makeBatch(long k, char (*text)[24], CommandText* batch) {
+    for (int i = 0; i < 3; i++) {
+      snprintf(text[i], sizeof(text[i]), "%s=%ld", NAMES[i], k);
+      batch[i] = CommandText(text[i]);
+    }
+  }
+}
+
+// Capacity, all-or-nothing pushes and the per-frame budget, single-threaded
+inline void checkCommandQueueEdges(CheckTally& tally) {
+  using namespace QueueChecks;
+
+  CommandParser parser;
+  parser.registerCommands(commands, 3);
+  CommandQueue<16> queue;
+  char text[3][24];
+  CommandText batch[3];
+
+  int pushed = 0;
+  while (true) {
+    makeBatch(pushed + 1, text, batch);
+    if (!queue.pushBatch(batch, 3)) break;
+    pushed++;
+  }
+  tally.expect(pushed == queue.capacity() / 3 && queue.getBatchesRejected() == 1,
+               "batch that does not fit is rejected whole");
+
+  applied = 0;
+  int first = queue.apply(parser, 4);
+  tally.expect(first == 3 && applied == 3 && values[2] == 1, "budget stops at a batch boundary");
+  tally.expect(queue.apply(parser, 2) == 3, "a batch larger than the budget still goes through alone");
+
+  // Queues sharing one frame budget: once it is spent, later queues wait
+  CommandQueue<16> other;
+  makeBatch(100, text, batch);
+  other.pushBatch(batch, 3);
+  int frame = queue.apply(parser, 2);
+  frame += other.apply(parser, 2, frame);
+  tally.expect(frame == 3 && other.available() == 3, "no batch past a budget another queue spent");
+  tally.expect(other.apply(parser, 4, 3) == 0 && other.apply(parser, 6, 3) == 3,
+               "shared budget stops at a batch boundary");
+
+  std::string longCommand = "pattern=" + std::string(SystemConfig::COMMAND_MAX_LENGTH, '1');
+  CommandText tooLong(longCommand.c_str());
+  tally.expect(!queue.push(tooLong), "command longer than a slot is rejected");
+
+  while (queue.apply(parser, 100) > 0) {}
+  tally.expect(queue.available() == 0 && applied == (unsigned long)pushed * 3 + 3, "drains completely");
+}
+
+// Web task hammering the queue while loop() drains at frame start, both
+// spinning: every batch must arrive whole, in order, exactly once
+inline void checkCommandQueueThreads(CheckTally& tally) {
+  using namespace QueueChecks;
+
+  CommandParser parser;
+  parser.registerCommands(commands, 3);
+  CommandQueue<WiFiConfig::COMMAND_QUEUE_SLOTS> queue;
+  const long batches = 200000;
+
+  std::thread producer([&]() {
+    char text[3][24];
+    CommandText batch[3];
+    for (long k = 1; k <= batches; k++) {
+      makeBatch(k, text, batch);
+      while (!queue.pushBatch(batch, 3)) std::this_thread::yield();
+    }
+  });
+
+  applied = 0;
+  unsigned long frames = 0;
+  unsigned long torn = 0;
+  unsigned long skipped = 0;
+  unsigned long overBudget = 0;
+  long lastBatch = 0;
+  while (lastBatch < batches) {
+    int count = queue.apply(parser, SystemConfig::COMMANDS_PER_FRAME);
+    if (count == 0) continue;
+    frames++;
+    if (count > SystemConfig::COMMANDS_PER_FRAME) overBudget++;
+    if (values[0] != values[1] || values[1] != values[2]) torn++;
+    if (values[2] != lastBatch + count / 3) skipped++;
+    lastBatch = values[2];
+  }
+  producer.join();
+
+  printf("  queue stress          %ld batches in %lu frames (%.1f commands/frame), %lu full-queue retries\n",
+         batches, frames, (double)applied / frames, queue.getBatchesRejected());
+  tally.expect(torn == 0, "stress: no batch applied partially");
+  tally.expect(skipped == 0 && applied == (unsigned long)batches * 3, "stress: batches applied in order, once");
+  tally.expect(overBudget == 0, "stress: per-frame budget respected");
+}
+
+inline void verifyCommandParser(CommandParser& parser) {
+  benchSection("CommandParser checks");
+
+  parser.registerCommands(ParserChecks::commands, ParserChecks::NAME_COUNT);
+  Serial.setMuted(true);
+
+  CheckTally tally;
+  checkParserRegressions(tally, parser);
+  checkParserFuzz(tally, parser, 300000);
+  checkCommandQueueEdges(tally);
+  checkCommandQueueThreads(tally);
+
+  Serial.setMuted(false);
+  printf("  dispatch table        %d commands, longest probe %d\n",
+         ParserChecks::NAME_COUNT, parser.getLongestProbe());
+  printf("  %d passed, %d failed\n", tally.passed, tally.failed);
+}
+
+#endif // COMMAND_PARSER_CHECKS_H
@@ -0,0 +1,288 @@
+#ifndef GESTURE_RECOGNIZER_CHECKS_H
+#define GESTURE_RECOGNIZER_CHECKS_H
+
+// Host checks for the DTW gesture recognizer. Eight synthetic gestures are
+// recorded through the recording path, then performed again faster, slower,
+// weaker, stronger and tilted, between stretches of rest. Each performance
+// has to fire its own template exactly once. A minute of everyday handling
+// (walking, tilting, slow turns, a light shake) must fire nothing. The early
+// abandoning kernel must decide exactly like the full alignment. Throughput
+// is measured per template count on a recorded frame stream.
+
+#include <cmath>
+#include <vector>
+#include <string>
+#include <Preferences.h>
+#include "hardware/OrientationFilter.h"
+#include "motion/GestureRecognizer.h"
+#include "sim/ImuTraces.h"
+#include "BenchHarness.h"
+
+namespace GestureChecks {
+  static constexpr float PI_F = 3.14159265f;
+
+  // Rates (dps) and hand acceleration (g) at phase p in [0, 1)
+  struct Gesture {
+    const char* name;
+    float seconds;
+    void (*motion)(float p, float* rate, float* hand);
+  };
+
+  inline const Gesture* gestures() {
+    static const Gesture list[] = {
+      {"flick", 0.4f, [](float p, float* g, float*) { g[0] = 220 * sinf(2 * PI_F * p); }},
+      {"twist", 0.5f, [](float p, float* g, float*) { g[1] = 200 * sinf(2 * PI_F * p); }},
+      {"spin", 0.4f, [](float p, float* g, float*) { g[2] = 220 * sinf(2 * PI_F * p); }},
+      {"shake2", 0.6f, [](float p, float*, float* a) { a[0] = 1.0f * sinf(4 * PI_F * p); }},
+      {"punch", 0.4f, [](float p, float*, float* a) { a[1] = 1.2f * sinf(2 * PI_F * p); }},
+      {"lift", 0.5f, [](float p, float*, float* a) { a[2] = 0.8f * sinf(2 * PI_F * p); }},
+      {"eight", 1.2f, [](float p, float* g, float*) {
+        g[0] = 120 * sinf(2 * PI_F * p);
+        g[2] = 120 * sinf(4 * PI_F * p);
+      }},
+      {"diagonal", 0.6f, [](float p, float* g, float*) {
+        g[0] = 150 * sinf(2 * PI_F * p);
+        g[1] = 150 * sinf(2 * PI_F * p);
+      }},
+    };
+    return list;
+  }
+  static constexpr int GESTURE_COUNT = 8;
+
+  // Perform `gesture` taking `stretch` times as long: rates scale by
+  // amplitude / stretch, hand acceleration by amplitude / stretch^2
+  inline void perform(ImuTrace& trace, const Gesture& gesture, float stretch, float amplitude) {
+    int count = (int)lroundf(gesture.seconds * stretch / ImuTrace::DT);
+    for (int i = 0; i < count; i++) {
+      float rate[3] = {0, 0, 0};
+      float hand[3] = {0, 0, 0};
+      gesture.motion((float)i / count, rate, hand);
+      float rateScale = amplitude / stretch;
+      float handScale = amplitude / (stretch * stretch);
+      trace.rotate(rate[0] * rateScale, rate[1] * rateScale, rate[2] * rateScale, ImuTrace::DT,
+                   [&](float, float& x, float& y, float& z) {
+                     x = hand[0] * handScale;
+                     y = hand[1] * handScale;
+                     z = hand[2] * handScale;
+                   });
+    }
+  }
+
+  // Everyday handling: walking, tilting, slow turns, setting down, a light shake
+  inline void handle(ImuTrace& trace, float seconds) {
+    float start = trace.size() * ImuTrace::DT;
+    while (trace.size() * ImuTrace::DT - start < seconds) {
+      trace.hold(2);
+      trace.rotate(0, 0, 0, 8, [](float t, float& x, float&, float& z) {
+        z = 0.15f * sinf(2 * PI_F * 1.8f * t);       // Walking, 1.8 steps/s
+        x = 0.05f * sinf(2 * PI_F * 0.9f * t);
+      });
+      trace.rotate(30, 0, 0, 1.5f);                     // Tilt over and back
+      trace.hold(1);
+      trace.rotate(-30, 0, 0, 1.5f);
+      trace.rotate(0, 0, 40, 4);                        // Slow turn
+      trace.rotate(0, 0, 0, 0.4f, [](float t, float&, float&, float& z) {
+        z = -0.3f * sinf(2 * PI_F * 1.25f * t);      // Set down
+      });
+      trace.shake(3, 0.3f, 4);
+      trace.rotate(0, 15, 0, 2);                        // Drift while holding
+      trace.rotate(0, -15, 0, 2);
+    }
+  }
+
+  // Feed a trace through the orientation filter and the recognizer; returns
+  // the frames it produced
+  inline std::vector<GestureRecognizer::Frame> feed(GestureRecognizer& recognizer, const ImuTrace& trace) {
+    std::vector<GestureRecognizer::Frame> frames;
+    OrientationFilter filter;
+    for (const ImuSample& s : trace.getSamples()) {
+      filter.update(s.ax, s.ay, s.az, s.gx, s.gy, s.gz, ImuTrace::DT);
+      float upX, upY, upZ;
+      filter.getUp(upX, upY, upZ);
+      if (recognizer.update(s.ax, s.ay, s.az, s.gx, s.gy, s.gz, upX, upY, upZ)) {
+        frames.push_back(recognizer.getNewestFrame());
+      }
+    }
+    return frames;
+  }
+
+  struct Variant {
+    float stretch;
+    float amplitude;
+    float tilt;
+  };
+}
+
+inline void verifyGestureRecognizer() {
+  using namespace GestureChecks;
+  benchSection("Gesture recognizer (DTW templates, synthetic IMU traces)");
+  CheckTally tally;
+  Serial.setMuted(true);
+  HostFlash::erase();
+
+  // Record every gesture once, at nominal speed
+  GestureRecognizer recognizer;
+  int recorded = 0;
+  for (int g = 0; g < GESTURE_COUNT; g++) {
+    ImuTrace trace(100 + g);
+    trace.hold(0.5f);
+    perform(trace, gestures()[g], 1, 1);
+    trace.hold(1);
+    recognizer.startRecording(CommandText(gestures()[g].name));
+    feed(recognizer, trace);
+    int slot = recognizer.find(CommandText(gestures()[g].name));
+    int expected = (int)lroundf(gestures()[g].seconds * GestureConfig::FRAME_RATE_HZ);
+    if (slot >= 0 && abs(recognizer.getTemplate(slot).length - expected) <= 3) recorded++;
+  }
+  tally.expect(recorded == GESTURE_COUNT && !recognizer.isRecording(), "all gestures recorded at their length");
+
+  // Perform each one again, varied, between rests; one stream for everything
+  const Variant variants[] = {{1.0f, 1.0f, 0}, {0.8f, 1.1f, 0}, {1.25f, 0.9f, 0},
+                              {1.0f, 0.8f, 0}, {1.1f, 1.2f, 0}, {1.0f, 1.0f, 0.4f}};
+  const int variantCount = sizeof(variants) / sizeof(variants[0]);
+  ImuTrace performances(200);
+  std::vector<size_t> starts;           // First sample of each performance
+  std::vector<int> performed;
+  for (int v = 0; v < variantCount; v++) {
+    performances.setTilt(variants[v].tilt);
+    performances.hold(3);
+    for (int g = 0; g < GESTURE_COUNT; g++) {
+      performances.hold(1.2f);
+      starts.push_back(performances.size());
+      perform(performances, gestures()[g], variants[v].stretch, variants[v].amplitude);
+      performed.push_back(g);
+    }
+  }
+  performances.setTilt(0);
+  performances.hold(1.2f);
+  starts.push_back(performances.size());
+
+  // Same stream through the full alignment, to compare decisions
+  GestureRecognizer full = recognizer;
+  full.setEarlyAbandon(false);
+  std::vector<int> fired, firedFull;
+  std::vector<size_t> firedAt;
+  size_t sampleIndex = 0;
+  recognizer.setOnGesture([&](int slot) {
+    fired.push_back(slot);
+    firedAt.push_back(sampleIndex);
+  });
+  full.setOnGesture([&](int slot) { firedFull.push_back(slot); });
+
+  OrientationFilter filter;
+  const std::vector<ImuSample>& samples = performances.getSamples();
+  for (sampleIndex = 0; sampleIndex < samples.size(); sampleIndex++) {
+    const ImuSample& s = samples[sampleIndex];
+    filter.update(s.ax, s.ay, s.az, s.gx, s.gy, s.gz, ImuTrace::DT);
+    float upX, upY, upZ;
+    filter.getUp(upX, upY, upZ);
+    recognizer.update(s.ax, s.ay, s.az, s.gx, s.gy, s.gz, upX, upY, upZ);
+    full.update(s.ax, s.ay, s.az, s.gx, s.gy, s.gz, upX, upY, upZ);
+  }
+
+  // Score each performance by what fired before the next one started
+  int correct = 0;
+  int wrong = 0;
+  int missed = 0;
+  for (size_t n = 0; n < performed.size(); n++) {
+    int matches = 0;
+    bool right = false;
+    for (size_t f = 0; f < fired.size(); f++) {
+      if (firedAt[f] < starts[n] || firedAt[f] >= starts[n + 1]) continue;
+      matches++;
+      right = strcmp(recognizer.getTemplate(fired[f]).name, gestures()[performed[n]].name) == 0;
+    }
+    if (matches == 0) missed++;
+    else if (matches == 1 && right) correct++;
+    else wrong++;
+  }
+  int total = (int)performed.size();
+  unsigned long alignments = recognizer.getAlignments();
+  unsigned long abandonedShare = alignments > 0 ? recognizer.getAbandoned() * 100 / alignments : 0;
+  unsigned long cellsAbandoning = recognizer.getCells();
+  unsigned long cellsFull = full.getCells();
+
+  tally.expect(correct == total, "every performance fires its own gesture exactly once");
+  tally.expect(wrong == 0, "no performance fires a wrong or extra gesture");
+  tally.expect(fired == firedFull, "early abandoning decides exactly like the full alignment");
+
+  // A minute of everyday handling
+  ImuTrace everyday(300);
+  handle(everyday, 60);
+  int falseBefore = (int)fired.size();
+  std::vector<GestureRecognizer::Frame> handlingFrames = feed(recognizer, everyday);
+  int falseMatches = (int)fired.size() - falseBefore;
+  tally.expect(falseMatches == 0, "no gesture fires during a minute of everyday handling");
+
+  // Templates come back from flash
+  GestureRecognizer rebooted;
+  int loaded = rebooted.load();
+  bool same = loaded == GESTURE_COUNT;
+  for (int g = 0; same && g < GESTURE_COUNT; g++) {
+    int slot = rebooted.find(CommandText(gestures()[g].name));
+    same = slot >= 0 && memcmp(&rebooted.getTemplate(slot),
+                               &recognizer.getTemplate(recognizer.find(CommandText(gestures()[g].name))),
+                               sizeof(GestureRecognizer::Template)) == 0;
+  }
+  tally.expect(same, "templates reload from flash unchanged");
+
+  // Damaged records are skipped like a version mismatch: too long, no
+  // energy, unterminated name, unterminated command
+  int rejected = 0;
+  for (int damage = 0; damage < 4; damage++) {
+    std::vector<uint8_t>& entry = HostFlash::entries[std::string(GestureConfig::PREFERENCES_NAMESPACE) + "/t00"];
+    std::vector<uint8_t> intact = entry;
+    GestureRecognizer::Template* stored =
+        reinterpret_cast<GestureRecognizer::Template*>(entry.data() + entry.size() - sizeof(GestureRecognizer::Template));
+    if (damage == 0) stored->length = GestureConfig::MAX_TEMPLATE_FRAMES + 1;
+    if (damage == 1) stored->energy = 0;
+    if (damage == 2) memset(stored->name, 'x', sizeof(stored->name));
+    if (damage == 3) memset(stored->command, 'x', sizeof(stored->command));
+    GestureRecognizer damaged;
+    if (damaged.load() == GESTURE_COUNT - 1 && damaged.getTemplate(0).length == 0) rejected++;
+    entry = intact;
+  }
+  tally.expect(rejected == 4, "out-of-range or unterminated flash records are skipped");
+  recognizer.setOnGesture(nullptr);
+
+  // Throughput per template count on a mixed stream (handling + performances)
+  std::vector<GestureRecognizer::Frame> stream = handlingFrames;
+  {
+    GestureRecognizer framer;
+    std::vector<GestureRecognizer::Frame> frames = feed(framer, performances);
+    stream.insert(stream.end(), frames.begin(), frames.end());
+  }
+  Serial.setMuted(false);
+
+  printf("  %d performances: %d correct, %d wrong, %d missed; %d false matches in 60 s of handling\n",
+         total, correct, wrong, missed, falseMatches);
+  printf("  alignments %lu, %lu%% abandoned; %.1f cells/alignment vs %.1f without abandoning\n",
+         alignments, abandonedShare, (double)cellsAbandoning / alignments,
+         (double)cellsFull / max(1UL, full.getAlignments()));
+
+  const int counts[] = {1, 2, 4, 8};
+  double eightAbandoning = 0;
+  for (int count : counts) {
+    for (int abandon = 1; abandon >= 0; abandon--) {
+      if (!abandon && count != 8) continue;
+      GestureRecognizer bench = recognizer;
+      bench.setEarlyAbandon(abandon);
+      Serial.setMuted(true);
+      for (int g = count; g < GESTURE_COUNT; g++) bench.forget(CommandText(gestures()[g].name));
+      Serial.setMuted(false);
+      char name[48];
+      snprintf(name, sizeof(name), "match frame, %d template%s%s", count, count > 1 ? "s" : "",
+               abandon ? "" : " (full)");
+      BenchResult result = runBench(name, 200000, [&](unsigned long i) {
+        bench.pushFrame(stream[i % stream.size()]);
+      });
+      printf("  %-36s %12.2f us of host CPU per second of frames (%d Hz)\n", "",
+             result.nsPerOp * GestureConfig::FRAME_RATE_HZ / 1000.0, GestureConfig::FRAME_RATE_HZ);
+      if (count == 8 && abandon) eightAbandoning = result.nsPerOp;
+    }
+  }
+  tally.expect(eightAbandoning < 20000, "eight templates match in under 20 us per frame on the host");
+  printf("  %d passed, %d failed\n", tally.passed, tally.failed);
+}
+
+#endif // GESTURE_RECOGNIZER_CHECKS_H
@@ -0,0 +1,184 @@
+#ifndef ORIENTATION_CHECKS_H
+#define ORIENTATION_CHECKS_H
+
+// Host checks for the orientation filter: IMU traces replayed through
+// MPU6050Model's FIFO and the real MPUSensor drain, so every sample takes the
+// device path (decode, filter, gesture detection). Filtered tilt and roll are
+// compared with the trace's ground truth and with the raw accelerometer the
+// tilt used to come from.
+
+#include <cmath>
+#include <vector>
+#include "hardware/MPUSensor.h"
+#include "motion/GestureDetector.h"
+#include "sim/MPU6050Model.h"
+#include "sim/ImuTraces.h"
+#include "BenchHarness.h"
+
+namespace OrientationChecks {
+  struct Replay {
+    std::vector<float> tilt;      // mpu.getTiltAngle() per sample
+    std::vector<float> roll;      // Filter roll per sample, degrees
+    float rotationX = 0;          // Integrated rotation over the trace, degrees
+    float rotationZ = 0;
+    int xRotations = 0;           // RotationDetector triggers
+    int zRotations = 0;
+  };
+
+  inline void replay(MPUSensor& mpu, MPU6050Model& model, GestureDetector& gestures,
+                     const ImuTrace& trace, Replay& result) {
+    result = Replay();
+    float startX = mpu.getRotationX();
+    float startZ = mpu.getRotationZ();
+
+    mpu.setOnSample([&](MPUSensor& sample, unsigned long sampleTime) {
+      result.tilt.push_back(sample.getTiltAngle());
+      result.roll.push_back(sample.getOrientation().getRoll());
+      gestures.update(sample, sampleTime);
+    });
+    gestures.setOnXRotation([&](bool) { result.xRotations++; });
+    gestures.setOnZRotation([&](bool) { result.zRotations++; });
+
+    const std::vector<ImuSample>& samples = trace.getSamples();
+    const size_t chunk = 10;
+    for (size_t first = 0; first < samples.size(); first += chunk) {
+      std::vector<uint8_t> dump;
+      for (size_t i = first; i < samples.size() && i < first + chunk; i++) {
+        const ImuSample& s = samples[i];
+        MPU6050Model::appendRecord(dump, s.ax, s.ay, s.az, s.gx, s.gy, s.gz);
+      }
+      model.setTemperature(samples[min(first + chunk, samples.size()) - 1].temperature);
+      model.loadFifoDump(dump);
+      HostClock::advanceMillis(chunk * MPUSensor::SAMPLE_PERIOD_MS);
+      mpu.read();
+    }
+
+    result.rotationX = mpu.getRotationX() - startX;
+    result.rotationZ = mpu.getRotationZ() - startZ;
+    gestures.setOnXRotation(nullptr);
+    gestures.setOnZRotation(nullptr);
+  }
+
+  // Worst |tilt - truth| from sample `from` on; raw: the accelerometer tilt
+  inline float worstTiltError(const ImuTrace& trace, const Replay& result, size_t from, bool raw) {
+    float worst = 0;
+    const std::vector<ImuSample>& samples = trace.getSamples();
+    for (size_t i = from; i < samples.size() && i < result.tilt.size(); i++) {
+      float tilt = raw ? constrain(samples[i].ax, -1.0f, 1.0f) : result.tilt[i];
+      worst = max(worst, fabsf(tilt - samples[i].upX));
+    }
+    return worst;
+  }
+
+  inline float worstRollError(const ImuTrace& trace, const Replay& result, size_t from) {
+    float worst = 0;
+    const std::vector<ImuSample>& samples = trace.getSamples();
+    for (size_t i = from; i < samples.size() && i < result.roll.size(); i++) {
+      float truth = atan2f(samples[i].upY, samples[i].upZ) * 57.29578f;
+      float error = fabsf(result.roll[i] - truth);
+      worst = max(worst, min(error, 360.0f - error));
+    }
+    return worst;
+  }
+
+  inline size_t samplesIn(float seconds) {
+    return (size_t)lroundf(seconds / ImuTrace::DT);
+  }
+}
+
+inline void verifyOrientation(MPUSensor& mpu, MPU6050Model& model, GestureDetector& gestures) {
+  using namespace OrientationChecks;
+  benchSection("Orientation filter (IMU trace replay, 100 Hz)");
+  CheckTally tally;
+
+  Serial.setMuted(true);
+  model.setAutoSample(false);
+  model.clearFifo();
+  mpu.read();
+  Replay result;
+
+  // Held at tilt 0.3 while the hand shakes +-0.4 g along X at 4 Hz
+  ImuTrace shaking(1);
+  shaking.setTilt(0.3f);
+  shaking.hold(3);
+  shaking.shake(5, 0.4f, 4);
+  replay(mpu, model, gestures, shaking, result);
+  float shakeFiltered = worstTiltError(shaking, result, samplesIn(3), false);
+  float shakeRaw = worstTiltError(shaking, result, samplesIn(3), true);
+
+  // Tipped 60 degrees over one second and back
+  ImuTrace sweep(2);
+  sweep.setTilt(0);
+  sweep.hold(3);
+  sweep.rotate(0, 60, 0, 1);
+  sweep.hold(0.5f);
+  sweep.rotate(0, -60, 0, 1);
+  sweep.hold(1);
+  replay(mpu, model, gestures, sweep, result);
+  float sweepFiltered = worstTiltError(sweep, result, samplesIn(3), false);
+
+  // A minute at rest with a gyro reading 3 deg/s about Y
+  ImuTrace biased(3);
+  biased.setTilt(0);
+  biased.hold(3);
+  biased.holdWithBias(60, 3.0f);
+  replay(mpu, model, gestures, biased, result);
+  float biasFiltered = worstTiltError(biased, result, samplesIn(3), false);
+
+  // Barrel roll: 380 degrees about X at 200 deg/s
+  ImuTrace roll(4);
+  roll.setTilt(0);
+  roll.hold(6);
+  roll.rotate(200, 0, 0, 1.9f);
+  roll.hold(2);
+  replay(mpu, model, gestures, roll, result);
+  float rollError = worstRollError(roll, result, samplesIn(6));
+  Replay rolled = result;
+
+  // Spin: 380 degrees about Z
+  ImuTrace spin(5);
+  spin.setTilt(0);
+  spin.hold(6);
+  spin.rotate(0, 0, 200, 1.9f);
+  spin.hold(2);
+  replay(mpu, model, gestures, spin, result);
+  float spinTilt = worstTiltError(spin, result, samplesIn(6), false);
+  Replay spun = result;
+
+  model.setAutoSample(true);
+  model.clearFifo();
+  mpu.setOnSample([&gestures](MPUSensor& sample, unsigned long sampleTime) {
+    gestures.update(sample, sampleTime);
+  });
+  Serial.setMuted(false);
+
+  printf("  shake +-0.4 g @ 4 Hz  tilt error %.3f filtered, %.3f raw accel\n", shakeFiltered, shakeRaw);
+  printf("  60 deg sweep in 1 s   tilt error %.3f\n", sweepFiltered);
+  printf("  gyro bias 3 deg/s     tilt error %.3f after 60 s (gyro alone: 180 deg)\n", biasFiltered);
+  printf("  barrel roll 380 deg   integrated %.1f deg, roll error %.1f deg, %d roll / %d spin triggers\n",
+         rolled.rotationX, rollError, rolled.xRotations, rolled.zRotations);
+  printf("  spin 380 deg          integrated %.1f deg, tilt error %.3f, %d roll / %d spin triggers\n",
+         spun.rotationZ, spinTilt, spun.xRotations, spun.zRotations);
+
+  tally.expect(shakeFiltered < 0.06f && shakeFiltered < shakeRaw / 4, "hand shake barely moves the tilt");
+  tally.expect(sweepFiltered < 0.05f, "tilt follows a fast sweep");
+  tally.expect(biasFiltered < 0.05f, "gyro bias does not drift the tilt");
+  tally.expect(fabsf(rolled.rotationX - 380) < 3 && rollError < 5, "roll tracks a barrel roll");
+  tally.expect(rolled.xRotations == 1 && rolled.zRotations == 0, "barrel roll triggers once, on X");
+  tally.expect(fabsf(spun.rotationZ - 380) < 3 && spinTilt < 0.05f, "spin leaves the tilt alone");
+  tally.expect(spun.zRotations == 1 && spun.xRotations == 0, "spin triggers once, on Z");
+
+  // Cost per sample; the device runs it at MPUConfig::SAMPLE_RATE_HZ
+  OrientationFilter filter;
+  BenchResult step = runBench("OrientationFilter::update", 2000000, [&](unsigned long i) {
+    float phase = (i & 1023) * 0.006f;
+    filter.update(0.3f + 0.01f * phase, 0.1f, 0.95f, 20.0f, -35.0f * phase, 5.0f, ImuTrace::DT);
+    benchKeep(filter);
+  });
+  printf("  filter at %d Hz      %.1f us of host CPU per second of samples\n",
+         MPUConfig::SAMPLE_RATE_HZ, step.nsPerOp * MPUConfig::SAMPLE_RATE_HZ / 1000.0);
+  tally.expect(step.nsPerOp < 500, "filter step under 500 ns on the host");
+  printf("  %d passed, %d failed\n", tally.passed, tally.failed);
+}
+
+#endif // ORIENTATION_CHECKS_H
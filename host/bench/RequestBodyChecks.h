@@ -0,0 +1,153 @@
+#ifndef REQUEST_BODY_CHECKS_H
+#define REQUEST_BODY_CHECKS_H
+
+// Host checks for RequestBody: /command bodies fed the way the async web
+// server delivers them (unterminated chunks with index/total), split at every
+// boundary and at random, plus oversize, out-of-order and concurrent bodies.
+
+#include <string>
+#include <vector>
+#include "control/RequestBody.h"
+#include "BenchHarness.h"
+
+namespace BodyChecks {
+  // Each request gets its own address, like AsyncWebServerRequest objects
+  int requestA, requestB, requestC;
+
+  std::string batchBody(size_t minLength) {
+    std::string body = "{\"commands\":[";
+    for (int i = 0; body.size() < minLength; i++) {
+      body += (i ? ",\"" : "\"") + std::string("brightness=0.") + std::to_string(i % 10) + "\"";
+    }
+    return body + "]}";
+  }
+
+  // body[from, from + len) followed by junk, so reading past `len` shows up
+  std::vector<uint8_t> unterminated(const std::string& body, size_t from, size_t len) {
+    std::vector<uint8_t> bytes(body.begin() + from, body.begin() + from + len);
+    bytes.insert(bytes.end(), 16, 'X');
+    return bytes;
+  }
+
+  // Feeds `body` in chunks ending at `cuts`; status of the last append
+  RequestBody::Status feed(RequestBody& accumulator, const void* request, const std::string& body,
+                           const std::vector<size_t>& cuts) {
+    RequestBody::Status status = RequestBody::PARTIAL;
+    size_t from = 0;
+    for (size_t i = 0; i <= cuts.size(); i++) {
+      size_t to = i < cuts.size() ? cuts[i] : body.size();
+      std::vector<uint8_t> chunk = unterminated(body, from, to - from);
+      status = accumulator.append(request, chunk.data(), to - from, from, body.size());
+      if (i < cuts.size() && status != RequestBody::PARTIAL) return status;
+      from = to;
+    }
+    return status;
+  }
+
+  bool holds(RequestBody& accumulator, const std::string& body) {
+    return accumulator.getLength() == body.size() &&
+           memcmp(accumulator.getData(), body.data(), body.size()) == 0 &&
+           accumulator.getData()[body.size()] == '\0';
+  }
+}
+
+inline void checkRequestBodyChunks(CheckTally& tally) {
+  using namespace BodyChecks;
+  RequestBody accumulator;
+
+  std::string small = "{\"command\":\"tap\"}";
+  tally.expect(feed(accumulator, &requestA, small, {}) == RequestBody::COMPLETE && holds(accumulator, small),
+               "single chunk, terminated without reading past it");
+
+  // Every two-chunk split of a 300-byte batch
+  std::string body = batchBody(300);
+  bool everySplit = true;
+  for (size_t cut = 1; cut < body.size(); cut++) {
+    everySplit = everySplit && feed(accumulator, &requestA, body, {cut}) == RequestBody::COMPLETE &&
+                 holds(accumulator, body);
+  }
+  tally.expect(everySplit, "two chunks, split at every offset");
+
+  bool randomSplits = true;
+  for (int run = 0; run < 2000; run++) {
+    std::string text = batchBody(random(1, WiFiConfig::COMMAND_BODY_MAX_BYTES - 40));
+    std::vector<size_t> cuts;
+    size_t at = 0;
+    while (true) {
+      at += random(1, 200);
+      if (at >= text.size()) break;
+      cuts.push_back(at);
+    }
+    randomSplits = randomSplits && feed(accumulator, &requestA, text, cuts) == RequestBody::COMPLETE &&
+                   holds(accumulator, text);
+  }
+  tally.expect(randomSplits, "random chunking up to the size limit");
+
+  std::string largest(WiFiConfig::COMMAND_BODY_MAX_BYTES, ' ');
+  tally.expect(feed(accumulator, &requestA, largest, {500}) == RequestBody::COMPLETE,
+               "body of exactly the limit accepted");
+}
+
+inline void checkRequestBodyRejects(CheckTally& tally) {
+  using namespace BodyChecks;
+  RequestBody accumulator;
+
+  std::string oversize = batchBody(WiFiConfig::COMMAND_BODY_MAX_BYTES + 1);
+  std::vector<uint8_t> first = unterminated(oversize, 0, 100);
+  bool refusedAtOnce = accumulator.append(&requestA, first.data(), 100, 0, oversize.size()) ==
+                       RequestBody::TOO_LARGE;
+  tally.expect(refusedAtOnce && feed(accumulator, &requestA, oversize, {100, 600}) == RequestBody::TOO_LARGE,
+               "oversize body refused at its first chunk and through to its last");
+
+  std::string body = batchBody(200);
+  std::vector<uint8_t> head = unterminated(body, 0, 50);
+  std::vector<uint8_t> tail = unterminated(body, 60, body.size() - 60);
+  accumulator.append(&requestA, head.data(), 50, 0, body.size());
+  tally.expect(accumulator.append(&requestA, tail.data(), body.size() - 60, 60, body.size()) ==
+               RequestBody::MALFORMED, "gap between chunks refused");
+
+  std::vector<uint8_t> whole = unterminated(body, 0, body.size());
+  accumulator.append(&requestA, whole.data(), 50, 0, body.size());
+  tally.expect(accumulator.append(&requestA, whole.data(), body.size(), 50, body.size()) ==
+               RequestBody::MALFORMED, "chunk running past total refused");
+
+  // Second request while the first is mid-body; the first still completes
+  accumulator.append(&requestA, head.data(), 50, 0, body.size());
+  bool busy = accumulator.append(&requestB, whole.data(), body.size(), 0, body.size()) == RequestBody::BUSY;
+  std::vector<uint8_t> rest = unterminated(body, 50, body.size() - 50);
+  bool firstDone = accumulator.append(&requestA, rest.data(), body.size() - 50, 50, body.size()) ==
+                   RequestBody::COMPLETE && holds(accumulator, body);
+  tally.expect(busy && firstDone, "concurrent body refused, the one in progress unaffected");
+
+  // An oversize body, then a second one while the first is mid-body: each
+  // refused body keeps its own answer through to its last chunk
+  std::string oversizeHead = oversize.substr(0, 50);
+  bool refusedC = accumulator.append(&requestC, (const uint8_t*)oversizeHead.data(), 50, 0, oversize.size()) ==
+                  RequestBody::TOO_LARGE;
+  accumulator.append(&requestA, head.data(), 50, 0, body.size());
+  bool refusedB = accumulator.append(&requestB, head.data(), 50, 0, body.size()) == RequestBody::BUSY;
+  bool restB = accumulator.append(&requestB, rest.data(), body.size() - 50, 50, body.size()) == RequestBody::BUSY;
+  bool restC = accumulator.append(&requestC, (const uint8_t*)oversize.data() + 50, 50, 50, oversize.size()) ==
+               RequestBody::TOO_LARGE;
+  bool restA = accumulator.append(&requestA, rest.data(), body.size() - 50, 50, body.size()) ==
+               RequestBody::COMPLETE && holds(accumulator, body);
+  tally.expect(refusedB && restB, "busy body answered busy through to its last chunk");
+  tally.expect(refusedC && restC && restA, "earlier refusal keeps its own status");
+
+  // A client that vanished mid-body stops blocking after the timeout
+  accumulator.append(&requestA, head.data(), 50, 0, body.size());
+  HostClock::advanceMillis(WiFiConfig::COMMAND_BODY_TIMEOUT_MS);
+  tally.expect(feed(accumulator, &requestB, body, {70}) == RequestBody::COMPLETE && holds(accumulator, body),
+               "abandoned body gives way after the timeout");
+}
+
+inline void verifyRequestBody() {
+  benchSection("RequestBody checks (/command chunked bodies)");
+
+  CheckTally tally;
+  checkRequestBodyChunks(tally);
+  checkRequestBodyRejects(tally);
+  printf("  %d passed, %d failed\n", tally.passed, tally.failed);
+}
+
+#endif // REQUEST_BODY_CHECKS_H
@@ -0,0 +1,117 @@
+#ifndef RING_BUFFER_CHECKS_H
+#define RING_BUFFER_CHECKS_H
+
+// Host checks for IsrRingBuffer: ordering, full/empty edges and wrap-around
+// against a std::deque model, plus a two-thread producer/consumer run standing
+// in for ISR vs loop().
+
+#include <atomic>
+#include <deque>
+#include <thread>
+#include "hardware/IsrRingBuffer.h"
+#include "BenchHarness.h"
+
+inline void checkRingBufferEdges(CheckTally& tally) {
+  IsrRingBuffer<unsigned long, 8> ring;
+  unsigned long value = 0;
+
+  tally.expect(ring.isEmpty() && !ring.pop(value), "new ring is empty");
+
+  for (int i = 0; i < ring.capacity(); i++) ring.push(100 + i);
+  tally.expect(ring.available() == ring.capacity(), "fills to capacity");
+  tally.expect(!ring.push(999), "push into a full ring fails");
+  tally.expect(ring.getDroppedCount() == 1, "rejected push is counted");
+
+  bool ordered = true;
+  for (int i = 0; i < ring.capacity(); i++) {
+    ordered = ordered && ring.pop(value) && value == (unsigned long)(100 + i);
+  }
+  tally.expect(ordered, "pops in push order");
+  tally.expect(ring.isEmpty(), "empty after draining");
+
+  ring.push(1);
+  ring.push(2);
+  ring.clear();
+  tally.expect(ring.isEmpty() && !ring.pop(value), "clear discards queued entries");
+}
+
+// Random push/pop bursts across many wrap-arounds, compared with a deque
+inline void checkRingBufferModel(CheckTally& tally) {
+  IsrRingBuffer<unsigned long, 16> ring;
+  std::deque<unsigned long> model;
+  unsigned long next = 0;
+  bool matches = true;
+
+  for (int round = 0; round < 20000 && matches; round++) {
+    int pushes = random(0, 12);
+    for (int i = 0; i < pushes; i++) {
+      bool accepted = ring.push(next);
+      bool room = (int)model.size() < ring.capacity();
+      matches = matches && (accepted == room);
+      if (room) model.push_back(next);
+      next++;
+    }
+
+    int pops = random(0, 12);
+    for (int i = 0; i < pops; i++) {
+      unsigned long value;
+      bool got = ring.pop(value);
+      matches = matches && (got == !model.empty());
+      if (got && !model.empty()) {
+        matches = matches && (value == model.front());
+        model.pop_front();
+      }
+    }
+    matches = matches && (ring.available() == (int)model.size());
+  }
+
+  tally.expect(matches, "matches deque model over 20000 random bursts");
+}
+
+// Producer thread (ISR) pushes a sequence, consumer (loop) pops it: every
+// value must arrive exactly once and in order. The producer retries when the
+// ring is full, so the drop counter measures how often it ran ahead.
+inline void checkRingBufferThreads(CheckTally& tally) {
+  static IsrRingBuffer<unsigned long, 64> ring;
+  const unsigned long count = 2000000;
+  std::atomic<bool> done(false);
+
+  std::thread producer([&]() {
+    for (unsigned long i = 1; i <= count; i++) {
+      while (!ring.push(i)) std::this_thread::yield();
+    }
+    done = true;
+  });
+
+  unsigned long received = 0;
+  unsigned long last = 0;
+  bool ordered = true;
+  unsigned long value;
+  while (!done || !ring.isEmpty()) {
+    if (ring.pop(value)) {
+      ordered = ordered && value == last + 1;
+      last = value;
+      received++;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+
+  tally.expect(ordered, "threaded: values arrive once, in order");
+  tally.expect(received == count, "threaded: nothing lost");
+  printf("  threaded run          %lu pushed, %lu received, %lu full-ring retries\n",
+         count, received, ring.getDroppedCount());
+}
+
+inline void verifyRingBuffer() {
+  benchSection("IsrRingBuffer checks");
+
+  CheckTally tally;
+  checkRingBufferEdges(tally);
+  checkRingBufferModel(tally);
+  checkRingBufferThreads(tally);
+  printf("  %d passed, %d failed\n", tally.passed, tally.failed);
+}
+
+#endif // RING_BUFFER_CHECKS_H
@@ -0,0 +1,104 @@
+#ifndef ROTATION_TIMING_CHECKS_H
+#define ROTATION_TIMING_CHECKS_H
+
+// Host checks for time-correct rotation integration. The model's sample clock
+// is switched to 50, 100 and 1000 Hz under firmware configured for
+// MPUConfig::SAMPLE_RATE_HZ, and the same 380-degree spin is driven through
+// the FIFO, the data-ready interrupt and the gesture detector. The filter
+// steps by the interrupt timestamps, so the spin has to integrate and trigger
+// the same way at every rate.
+
+#include <cmath>
+#include "hardware/MPUSensor.h"
+#include "motion/GestureDetector.h"
+#include "sim/MPU6050Model.h"
+#include "BenchHarness.h"
+
+namespace RotationTimingChecks {
+  struct Spin {
+    float rotationZ = 0;        // Integrated over the spin, degrees
+    int triggers = 0;           // Z rotation triggers
+    int spinSamples = 0;        // Samples delivered while spinning
+    float step = 0;             // Filter step the sensor measured, seconds
+  };
+
+  // Loop for `seconds` of virtual time, draining whenever a read is due
+  inline void run(MPUSensor& mpu, float seconds) {
+    uint64_t end = HostClock::getMicros() + (uint64_t)(seconds * 1000000.0f);
+    while (HostClock::getMicros() < end) {
+      HostClock::advanceMicros(500);
+      if (mpu.isReadDue(millis())) mpu.read();
+    }
+    mpu.read();
+  }
+
+  // 200 dps about Z for exactly 1.9 s, sampled at `rateHz`
+  inline Spin spinAt(MPUSensor& mpu, MPU6050Model& model, GestureDetector& gestures, int rateHz) {
+    Spin result;
+    model.writeRegister(MPU6050Model::REG_SMPLRT_DIV, 1000 / rateHz - 1);
+    model.setAutoSample(true);  // Restart the sample clock at the new period
+    model.setAccel(0, 0, 1);
+    model.setGyro(0, 0, 0);
+    run(mpu, 6);                // Past RotationConfig::FULL_RESET_MS at rest
+
+    mpu.setOnSample([&](MPUSensor& sample, unsigned long sampleTime) {
+      if (fabsf(sample.getGyroZ()) > RotationConfig::GYRO_THRESHOLD) {
+        result.spinSamples++;
+        result.step = sample.getSampleInterval();
+      }
+      gestures.update(sample, sampleTime);
+    });
+    gestures.setOnZRotation([&](bool) { result.triggers++; });
+
+    // Spin start and stop on the clock itself, so drains cannot stretch it
+    float start = mpu.getRotationZ();
+    uint64_t spinStart = HostClock::getMicros() + 250;
+    HostClock::schedule(spinStart, [&model]() { model.setGyro(0, 0, 200); });
+    HostClock::schedule(spinStart + 1900000, [&model]() { model.setGyro(0, 0, 0); });
+    run(mpu, 4);
+
+    result.rotationZ = mpu.getRotationZ() - start;
+    gestures.setOnZRotation(nullptr);
+    return result;
+  }
+}
+
+inline void verifyRotationTiming(MPUSensor& mpu, MPU6050Model& model, GestureDetector& gestures) {
+  using namespace RotationTimingChecks;
+  benchSection("Rotation integration vs sample rate (380 deg spin)");
+  CheckTally tally;
+
+  Serial.setMuted(true);
+  const int rates[] = {50, 100, 1000};
+  Spin spins[3];
+  for (int i = 0; i < 3; i++) spins[i] = spinAt(mpu, model, gestures, rates[i]);
+
+  // Back to the configured rate
+  model.writeRegister(MPU6050Model::REG_SMPLRT_DIV, 1000 / MPUConfig::SAMPLE_RATE_HZ - 1);
+  model.setAutoSample(true);
+  run(mpu, 0.1f);
+  mpu.setOnSample([&gestures](MPUSensor& sample, unsigned long sampleTime) {
+    gestures.update(sample, sampleTime);
+  });
+  Serial.setMuted(false);
+
+  for (int i = 0; i < 3; i++) {
+    // What the fixed nominal step made of the same samples
+    float fixedStep = spins[i].spinSamples * 200.0f * MPUSensor::SAMPLE_PERIOD_MS / 1000.0f;
+    printf("  %4d Hz  step %5.2f ms  integrated %6.1f deg (fixed %lu ms step: %6.1f)  %d trigger(s)\n",
+           rates[i], spins[i].step * 1000.0f, spins[i].rotationZ, MPUSensor::SAMPLE_PERIOD_MS,
+           fixedStep, spins[i].triggers);
+  }
+
+  for (int i = 0; i < 3; i++) {
+    char what[64];
+    snprintf(what, sizeof(what), "380 deg integrated within 1 deg at %d Hz", rates[i]);
+    tally.expect(fabsf(spins[i].rotationZ - 380.0f) < 1.0f, what);
+    snprintf(what, sizeof(what), "spin triggers exactly once at %d Hz", rates[i]);
+    tally.expect(spins[i].triggers == 1, what);
+  }
+  tally.expect(fabsf(spins[0].rotationZ - spins[2].rotationZ) < 1.0f, "same angle at 50 and 1000 Hz");
+  printf("  %d passed, %d failed\n", tally.passed, tally.failed);
+}
+
+#endif // ROTATION_TIMING_CHECKS_H
@@ -0,0 +1,180 @@
+#ifndef RUNNING_WINDOW_CHECKS_H
+#define RUNNING_WINDOW_CHECKS_H
+
+// Host checks for RunningWindow and the tap detector built on it: mean and
+// variance against a brute-force double recomputation over long streams
+// (rounding drift), tap times against the old shift-and-resum detector on a
+// 1 kHz trace, and per-sample cost at window sizes a 1 kHz sample rate needs.
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include "motion/RunningWindow.h"
+#include "motion/GestureDetector.h"
+#include "BenchHarness.h"
+
+namespace RunningWindowChecks {
+  // The detector as it was: shift the history down, re-sum the whole window
+  template <int Size>
+  struct ShiftingWindow {
+    float history[Size];
+
+    ShiftingWindow() {
+      for (int i = 0; i < Size; i++) history[i] = 1.0f;
+    }
+
+    float pushAndAverage(float value) {
+      for (int i = 0; i < Size - 1; i++) history[i] = history[i + 1];
+      history[Size - 1] = value;
+      float total = 0;
+      for (int i = 0; i < Size; i++) total += history[i];
+      return total / Size;
+    }
+  };
+
+  // Accelerometer magnitude at 1 kHz: gravity, sensor noise, a slow sway,
+  // and a sharp tap every 700 ms
+  struct Trace {
+    std::vector<float> x, y, z;
+  };
+
+  inline Trace makeTrace(int samples, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> noise(0.0f, 0.004f);
+    Trace trace;
+    for (int i = 0; i < samples; i++) {
+      float sway = 0.2f * sinf(i * 0.002f);
+      int sinceTap = i % 700;
+      float spike = sinceTap < 3 ? 0.45f - 0.15f * sinceTap : 0.0f;
+      trace.x.push_back(sway + noise(rng));
+      trace.y.push_back(noise(rng));
+      trace.z.push_back(sqrtf(1.0f - sway * sway) + spike + noise(rng));
+    }
+    return trace;
+  }
+
+  // Worst error of mean/variance over a stream, checked every `stride` pushes
+  template <int Size>
+  void compareWithBruteForce(int pushes, int stride, float scale, double& meanError, double& varianceError) {
+    std::mt19937 rng(Size);
+    std::normal_distribution<float> noise(0.0f, scale);
+    RunningWindow<Size> window(1.0f);
+    std::vector<float> recent(Size, 1.0f);
+    meanError = 0;
+    varianceError = 0;
+
+    for (int i = 0; i < pushes; i++) {
+      float value = 1.0f + 0.3f * sinf(i * 0.0007f) + noise(rng);
+      window.push(value);
+      recent[i % Size] = value;
+      if (i % stride != 0) continue;
+
+      double mean = 0;
+      for (float v : recent) mean += v;
+      mean /= Size;
+      double variance = 0;
+      for (float v : recent) variance += (v - mean) * (v - mean);
+      variance /= Size;
+
+      meanError = std::max(meanError, std::fabs(window.getMean() - mean));
+      varianceError = std::max(varianceError, std::fabs(window.getVariance() - variance));
+    }
+  }
+}
+
+inline void verifyRunningWindow() {
+  using namespace RunningWindowChecks;
+  benchSection("Running window statistics (tap baseline, 1 kHz)");
+  CheckTally tally;
+
+  // Edges: fill, eviction order, a constant window has no variance
+  RunningWindow<4> small(1.0f);
+  tally.expect(small.getMean() == 1.0f && small.getVariance() == 0.0f, "filled window: mean 1, variance 0");
+  tally.expect(small.push(2.0f) == 1.0f && small.getNewest() == 2.0f, "push returns the evicted sample");
+  small.push(3.0f);
+  small.push(4.0f);
+  small.push(5.0f);
+  tally.expect(small.getOldest() == 2.0f && fabsf(small.getMean() - 3.5f) < 1e-6f, "window holds the last 4");
+  tally.expect(fabsf(small.getVariance() - 1.25f) < 1e-5f, "variance of 2,3,4,5 is 1.25");
+
+  // Long streams: incremental sums stay on the brute-force values
+  double meanError, varianceError;
+  compareWithBruteForce<5>(2000000, 7, 0.01f, meanError, varianceError);
+  printf("  window 5, 2M pushes   mean error %.2e g, variance error %.2e g^2\n", meanError, varianceError);
+  tally.expect(meanError < 1e-5 && varianceError < 1e-6, "window 5 stays exact over 2M pushes");
+
+  compareWithBruteForce<250>(2000000, 997, 0.01f, meanError, varianceError);
+  printf("  window 250, 2M pushes mean error %.2e g, variance error %.2e g^2\n", meanError, varianceError);
+  tally.expect(meanError < 1e-5 && varianceError < 1e-6, "window 250 stays exact over 2M pushes");
+
+  // Tiny wiggles on top of 1 g and a moving mean do not cancel out
+  compareWithBruteForce<50>(200000, 13, 0.0005f, meanError, varianceError);
+  printf("  window 50, 0.5 mg     mean error %.2e g, variance error %.2e g^2\n", meanError, varianceError);
+  tally.expect(varianceError < 2.5e-8, "variance of 0.5 mg noise resolved at 1 g");
+
+  // Same taps, same times as the shift-and-resum detector
+  const int samples = 20000;  // 20 s at 1 kHz
+  Trace trace = makeTrace(samples, 7);
+  ShiftingWindow<MotionConfig::TAP_HISTORY_SIZE> reference;
+  std::vector<unsigned long> expectedTaps, detectedTaps;
+  unsigned long lastReferenceTap = 0;
+  for (int i = 0; i < samples; i++) {
+    float magnitude = sqrtf(trace.x[i] * trace.x[i] + trace.y[i] * trace.y[i] + trace.z[i] * trace.z[i]);
+    float spike = magnitude - reference.pushAndAverage(magnitude);
+    if (spike > MotionConfig::TAP_THRESHOLD && (unsigned long)i - lastReferenceTap > MotionConfig::TAP_DEBOUNCE_MS) {
+      lastReferenceTap = i;
+      expectedTaps.push_back(i);
+    }
+  }
+
+  GestureDetector detector;
+  MPUSensor sample;
+  static unsigned long sampleTime = 0;
+  static std::vector<unsigned long>* taps = nullptr;
+  taps = &detectedTaps;
+  detector.setOnTap([]() { taps->push_back(sampleTime); });
+  Serial.setMuted(true);
+  for (int i = 0; i < samples; i++) {
+    sample.setAccel(trace.x[i], trace.y[i], trace.z[i]);
+    sampleTime = i;
+    detector.update(sample, sampleTime);
+  }
+  Serial.setMuted(false);
+  printf("  1 kHz trace           %zu taps (reference %zu), baseline %.3f g, noise %.4f g\n",
+         detectedTaps.size(), expectedTaps.size(), detector.getTapBaseline(), detector.getAccelNoise());
+  tally.expect(!expectedTaps.empty() && detectedTaps == expectedTaps, "taps match the shift-and-resum detector");
+
+  // Per-sample cost; at 1 kHz a 50 ms baseline is 50 samples
+  ShiftingWindow<5> shift5;
+  ShiftingWindow<50> shift50;
+  ShiftingWindow<250> shift250;
+  RunningWindow<5> running5(1.0f);
+  RunningWindow<50> running50(1.0f);
+  RunningWindow<250> running250(1.0f);
+  auto value = [&](unsigned long i) { return trace.z[i % samples]; };
+  runBench("shift + re-sum, window 5", 2000000, [&](unsigned long i) { benchKeep(shift5.pushAndAverage(value(i))); });
+  runBench("RunningWindow<5>::push + mean", 2000000, [&](unsigned long i) {
+    running5.push(value(i));
+    benchKeep(running5.getMean());
+  });
+  runBench("shift + re-sum, window 50", 1000000, [&](unsigned long i) { benchKeep(shift50.pushAndAverage(value(i))); });
+  runBench("RunningWindow<50>::push + mean", 2000000, [&](unsigned long i) {
+    running50.push(value(i));
+    benchKeep(running50.getMean());
+  });
+  runBench("shift + re-sum, window 250", 200000, [&](unsigned long i) { benchKeep(shift250.pushAndAverage(value(i))); });
+  runBench("RunningWindow<250>::push + mean", 2000000, [&](unsigned long i) {
+    running250.push(value(i));
+    benchKeep(running250.getMean());
+  });
+
+  BenchResult update = runBench("GestureDetector::update (1 kHz trace)", 1000000, [&](unsigned long i) {
+    sample.setAccel(trace.x[i % samples], trace.y[i % samples], trace.z[i % samples]);
+    detector.update(sample, i);
+  });
+  detector.setOnTap(nullptr);
+  printf("  gestures at 1 kHz     %.0f us of host CPU per second of samples\n", update.nsPerOp);
+  printf("  %d passed, %d failed\n", tally.passed, tally.failed);
+}
+
+#endif // RUNNING_WINDOW_CHECKS_H
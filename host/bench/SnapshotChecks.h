@@ -0,0 +1,119 @@
+#ifndef SNAPSHOT_CHECKS_H
+#define SNAPSHOT_CHECKS_H
+
+// Host checks for SeqlockSnapshot: a writer thread standing in for loop()
+// publishes a DeviceStateSnapshot per "frame" while reader threads standing in
+// for the HTTP, event-stream and binary status paths copy it as fast as they
+// can. Every field of frame k is derived from k, so a copy mixing two frames
+// shows up as fields that disagree.
+
+#include <atomic>
+#include <thread>
+#include "control/DeviceSnapshot.h"
+#include "BenchHarness.h"
+
+namespace SnapshotChecks {
+  void fill(DeviceStateSnapshot& snapshot, uint32_t frame) {
+    snapshot.frame = frame;
+    snapshot.capturedAt = frame * 16UL;
+    DashboardStatus& status = snapshot.status;
+    status.liquid = frame & 1;
+    status.bpm = (int)frame;
+    status.batteryPercent = (int)(frame % 101);
+    status.palette = (int)(frame % 18);
+    status.pattern = (int)(frame % 6);
+    status.tilt = -(int)frame;
+    status.accelY = (int)frame * 3;
+    status.accelZ = (int)frame * 7;
+    status.beat = frame & 2;
+    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+      status.leds[i] = (uint8_t)((frame + i) % 101);
+      status.colors[i] = frame * 2654435761u + i;
+    }
+  }
+
+  bool consistent(const DeviceStateSnapshot& snapshot) {
+    DeviceStateSnapshot expected;
+    fill(expected, snapshot.frame);
+    const DashboardStatus& a = expected.status;
+    const DashboardStatus& b = snapshot.status;
+    return expected.capturedAt == snapshot.capturedAt && a.liquid == b.liquid && a.bpm == b.bpm &&
+           a.batteryPercent == b.batteryPercent && a.palette == b.palette && a.pattern == b.pattern &&
+           a.tilt == b.tilt && a.accelY == b.accelY && a.accelZ == b.accelZ && a.beat == b.beat &&
+           memcmp(a.leds, b.leds, sizeof(a.leds)) == 0 && memcmp(a.colors, b.colors, sizeof(a.colors)) == 0;
+  }
+}
+
+inline void verifySnapshots() {
+  using namespace SnapshotChecks;
+  benchSection("Device snapshot (seqlock, 1 writer + 3 readers)");
+
+  SeqlockSnapshot<DeviceStateSnapshot> snapshot;
+  const uint32_t frames = 300000;
+  const int readerCount = 3;
+  std::atomic<bool> writing(true);
+  std::atomic<unsigned long> reads(0), torn(0), regressed(0), failed(0);
+
+  std::thread writer([&]() {
+    DeviceStateSnapshot state;
+    for (uint32_t frame = 1; frame <= frames; frame++) {
+      fill(state, frame);
+      snapshot.publish(state);
+    }
+    writing = false;
+  });
+
+  std::thread readers[readerCount];
+  for (std::thread& reader : readers) {
+    reader = std::thread([&]() {
+      DeviceStateSnapshot copy;
+      uint32_t lastFrame = 0;
+      unsigned long count = 0;
+      while (writing.load()) {
+        if (!snapshot.read(copy)) {
+          failed++;
+          continue;
+        }
+        count++;
+        if (copy.frame != 0 && !consistent(copy)) torn++;
+        if (copy.frame < lastFrame) regressed++;
+        lastFrame = copy.frame;
+      }
+      reads += count;
+    });
+  }
+
+  writer.join();
+  for (std::thread& reader : readers) reader.join();
+
+  DeviceStateSnapshot last;
+  CheckTally tally;
+
+  // The check itself must notice a copy made of two frames
+  DeviceStateSnapshot mixed;
+  fill(mixed, 41);
+  mixed.status.colors[HardwareConfig::NUM_LEDS - 1] = 42 * 2654435761u + HardwareConfig::NUM_LEDS - 1;
+  tally.expect(!consistent(mixed), "a mixed copy is detected");
+
+  tally.expect(torn == 0, "no reader sees a mix of two frames");
+  tally.expect(regressed == 0, "readers never go back in time");
+  tally.expect(snapshot.read(last) && last.frame == frames && consistent(last), "last publish visible");
+
+  printf("  concurrent            %u publishes, %lu reads, %lu retried, %lu gave up\n",
+         frames, reads.load(), snapshot.getReadRetries(), failed.load());
+
+  DeviceStateSnapshot state;
+  fill(state, 1);
+  runBench("SeqlockSnapshot::publish", 1000000, [&](unsigned long i) {
+    state.frame = i;
+    snapshot.publish(state);
+  });
+  runBench("SeqlockSnapshot::read (uncontended)", 1000000, [&](unsigned long) {
+    snapshot.read(last);
+    benchKeep(last);
+  });
+  printf("  snapshot size         %zu bytes\n", sizeof(DeviceStateSnapshot));
+  printf("  %d passed, %d failed\n", tally.passed, tally.failed);
+}
+
+#endif // SNAPSHOT_CHECKS_H
@@ -0,0 +1,96 @@
+#ifndef STAGE_TIMING_CHECKS_H
+#define STAGE_TIMING_CHECKS_H
+
+// Host checks for the stage timing histograms: bucket layout, percentiles
+// against exact sorted values, /metrics formatting, and what a scoped timer
+// costs with timing enabled and compiled out.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "control/StageTimings.h"
+#include "BenchHarness.h"
+
+inline void checkHistogramBuckets(CheckTally& tally) {
+  bool roundTrip = true;
+  bool ordered = true;
+  for (int i = 0; i < LatencyHistogram::BUCKETS; i++) {
+    roundTrip = roundTrip && LatencyHistogram::bucketOf(LatencyHistogram::bucketTop(i)) == i;
+    if (i > 0) ordered = ordered && LatencyHistogram::bucketTop(i) > LatencyHistogram::bucketTop(i - 1);
+  }
+  tally.expect(roundTrip && ordered, "bucket bounds are contiguous and increasing");
+
+  bool exactSmall = true;
+  for (uint32_t v = 0; v < 8; v++) exactSmall = exactSmall && LatencyHistogram::bucketTop(LatencyHistogram::bucketOf(v)) == v;
+  tally.expect(exactSmall, "values below 8 us are exact");
+  tally.expect(LatencyHistogram::bucketOf(0xFFFFFFFFu) == LatencyHistogram::BUCKETS - 1, "huge values clamp to the top bucket");
+}
+
+// Random mixes (mostly short, occasional long stalls) vs std::sort
+inline void checkHistogramPercentiles(CheckTally& tally) {
+  double worstError = 0;
+  bool statsExact = true;
+  for (int run = 0; run < 200; run++) {
+    LatencyHistogram histogram;
+    std::vector<uint32_t> values;
+    int count = random(1, 5000);
+    for (int i = 0; i < count; i++) {
+      uint32_t v = random(0, 10) == 0 ? random(1000, 200000) : random(0, 2000);
+      values.push_back(v);
+      histogram.record(v);
+    }
+    std::sort(values.begin(), values.end());
+
+    const float quantiles[] = {0.5f, 0.9f, 0.99f};
+    for (float q : quantiles) {
+      uint32_t exact = values[(size_t)ceilf(q * values.size()) - 1];
+      uint32_t reported = histogram.getPercentile(q);
+      double error = exact ? ((double)reported - exact) / exact : reported;
+      if (reported < exact) error = 1;                  // Must never under-report
+      worstError = std::max(worstError, error);
+    }
+
+    uint64_t sum = 0;
+    for (uint32_t v : values) sum += v;
+    statsExact = statsExact && histogram.getMin() == values.front() && histogram.getMax() == values.back() &&
+                 histogram.getCount() == values.size() && histogram.getAverage() == (uint32_t)(sum / values.size());
+  }
+  printf("  percentile error      worst %.1f %% over 200 random mixes (bucket bound 25 %%)\n", worstError * 100);
+  tally.expect(worstError < 0.25, "p50/p90/p99 within one bucket above the exact value");
+  tally.expect(statsExact, "count/min/avg/max exact");
+}
+
+inline void checkMetricsText(CheckTally& tally) {
+  StageTimingsImpl<true> timings;
+  for (int i = 0; i < (int)Stage::COUNT; i++) {
+    for (uint32_t v = 0; v < 1000; v++) timings.record((Stage)i, 0xFFFFFFF0u - v);  // Widest numbers
+  }
+
+  char text[WiFiConfig::METRICS_MAX_BYTES];
+  size_t length = timings.formatMetrics(text, sizeof(text));
+  printf("  /metrics              %zu bytes (buffer %zu)\n", length, sizeof(text));
+  tally.expect(length < sizeof(text), "/metrics fits its buffer at the widest values");
+  tally.expect(std::string(text).find("ctenophore_stage_us{stage=\"render\",quantile=\"0.99\"}") != std::string::npos,
+               "/metrics carries the render p99");
+}
+
+inline void verifyStageTimings() {
+  benchSection("Stage timings");
+
+  CheckTally tally;
+  checkHistogramBuckets(tally);
+  checkHistogramPercentiles(tally);
+  checkMetricsText(tally);
+
+  static StageTimingsImpl<true> enabled;
+  static StageTimingsImpl<false> disabled;
+  runBench("ScopedStageTimer (enabled, host clock)", 1000000, [](unsigned long) {
+    ScopedStageTimerImpl<true> timer(enabled, Stage::RENDER);
+  });
+  runBench("ScopedStageTimer (compiled out)", 1000000, [](unsigned long) {
+    ScopedStageTimerImpl<false> timer(disabled, Stage::RENDER);
+  });
+  printf("  %d passed, %d failed\n", tally.passed, tally.failed);
+}
+
+#endif // STAGE_TIMING_CHECKS_H
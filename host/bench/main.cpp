@@ -0,0 +1,969 @@
+/**
+ * Ctenophore host simulation & benchmarks
+ *
+ * Compiles the real firmware modules from src/ against the host shim
+ * (virtual clock, scripted Wire bus, recording NeoPixel) and reports:
+ * - host CPU cost per call of the hot paths
+ * - simulated loop latency in virtual time (I2C + LED wire time included)
+ *
+ * Build & run:  pio run -e native && .pio/build/native/program
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_NeoPixel.h>
+
+#include "config/Constants.h"
+#include "hardware/MPUSensor.h"
+#include "hardware/LEDController.h"
+#include "motion/GestureDetector.h"
+#include "effects/PaletteManager.h"
+#include "effects/AnimationEngine.h"
+#include "effects/RenderScheduler.h"
+#include "tempo/TempoDetector.h"
+#include "tempo/BeatSynchronizer.h"
+#include <ArduinoJson.h>
+#include "control/CommandParser.h"
+#include "control/StatusPublisher.h"
+#include "control/StatusFrame.h"
+#include "control/DashboardHTML.h"
+#include "control/DashboardAsset.h"
+#include "control/TaskStats.h"
+#include "control/CommandQueue.h"
+#include "control/StageTimings.h"
+
+#include "sim/MPU6050Model.h"
+#include "sim/ReferenceRender.h"
+#include "BenchHarness.h"
+#include "RingBufferChecks.h"
+#include "CommandParserChecks.h"
+#include "RequestBodyChecks.h"
+#include "SnapshotChecks.h"
+#include "StageTimingChecks.h"
+#include "RunningWindowChecks.h"
+#include "OrientationChecks.h"
+#include "CalibrationChecks.h"
+#include "RotationTimingChecks.h"
+#include "GestureRecognizerChecks.h"
+
+#include <climits>
+#include <atomic>
+#include <new>
+
+// ===== HEAP ACCOUNTING =====
+// Every operator new in the process (firmware modules included) is counted
+static std::atomic<unsigned long> heapAllocations(0);
+static std::atomic<unsigned long> heapBytes(0);
+
+// GCC pairs the replaced new/delete by name and flags malloc/free inside them
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(size_t size) {
+  heapAllocations++;
+  heapBytes += size;
+  if (void* block = malloc(size ? size : 1)) return block;
+  throw std::bad_alloc();
+}
+void operator delete(void* block) noexcept { free(block); }
+void operator delete(void* block, size_t) noexcept { free(block); }
+
+// ===== SIMULATED HARDWARE =====
+MPU6050Model mpuModel;
+Adafruit_NeoPixel strip(HardwareConfig::NUM_LEDS, HardwareConfig::LED_PIN, NEO_GRB + NEO_KHZ800);
+
+// ===== MODULE INSTANCES =====
+MPUSensor mpu;
+LEDController leds(&strip);
+GestureDetector gestures;
+PaletteManager palettes;
+AnimationEngine animations(&leds, &palettes);
+TempoDetector tempo;
+BeatSynchronizer beatSync;
+CommandParser cmdParser;
+
+// Slow sway used to drive the tilt input
+static float swayAt(unsigned long i) {
+  return sinf(i * 0.01f) * 0.8f;
+}
+
+void benchRender() {
+  benchSection("Render");
+
+  animations.setPattern(PATTERN_CUSTOM);
+  runBench("AnimationEngine::updateLiquidPhysics", 200000, [](unsigned long i) {
+    animations.updateLiquidPhysics(swayAt(i), true);
+  });
+
+  runBench("AnimationEngine::render (palette)", 200000, [](unsigned long i) {
+    animations.render(swayAt(i));
+  });
+
+  animations.setPattern(PATTERN_RAINBOW_CYCLE);
+  runBench("AnimationEngine::render (rainbow)", 200000, [](unsigned long i) {
+    animations.setGlobalHue((float)(i % 360));
+    animations.render(0);
+  });
+
+  static uint32_t reference[HardwareConfig::NUM_LEDS];
+  runBench("ReferenceRender (float, rainbow)", 200000, [](unsigned long i) {
+    animations.setGlobalHue((float)(i % 360));
+    ReferenceRender::render(animations, palettes, 0, reference);
+    benchKeep(reference);
+  });
+
+  leds.show();
+  runBench("LEDController::show (unchanged)", 200000, [](unsigned long) {
+    leds.show();
+  });
+
+  runBench("LEDController::show (changed)", 200000, [](unsigned long i) {
+    leds.setColorRGB(i % HardwareConfig::NUM_LEDS, i & 0xFF, 0, 0);
+    leds.show();
+  });
+}
+
+// Hue-to-RGB conversions/second: float HSV math vs the wheel table
+void benchHueConversion() {
+  benchSection("Hue conversion");
+
+  BenchResult floatHsv = runBench("float hsvToRgb", 1000000, [](unsigned long i) {
+    benchKeep(ReferenceRender::hsvToRgb((i % 3600) / 3600.0f, 1.0f, 1.0f));
+  });
+
+  BenchResult table = runBench("ColorMath::hueToRgb (table)", 1000000, [](unsigned long i) {
+    benchKeep(ColorMath::hueToRgb((uint32_t)(i * 1193047UL)));
+  });
+
+  runBench("LEDController::setColorHSV", 1000000, [](unsigned long i) {
+    leds.setColorHSV(i % HardwareConfig::NUM_LEDS, (i % 3600) / 3600.0f, 0.6f);
+  });
+
+  printf("  float %.1f M/s, table %.1f M/s\n", 1000.0 / floatHsv.nsPerOp, 1000.0 / table.nsPerOp);
+}
+
+// Compare render() against the float reference across hues, palettes, levels
+// and color temperatures for one pattern
+// Returns the largest per-channel difference from the float reference
+int compareGoldenFrames(AnimationPattern pattern, const char* name) {
+  unsigned long frames = 0;
+  unsigned long pixels = 0;
+  unsigned long mismatched = 0;
+  int maxDelta = 0;
+  uint32_t expected[HardwareConfig::NUM_LEDS];
+  const float temperatures[] = {-1.0f, -0.35f, 0.0f, 0.5f, 1.0f};
+
+  Serial.setMuted(true);
+  animations.setPattern(pattern);
+
+  for (int palette = 0; palette < palettes.getTotalPaletteCount(); palette++) {
+    palettes.setCurrentPalette(palette);
+
+    for (int step = 0; step < 720; step++) {
+      animations.setGlobalHue(step * 0.5f);
+
+      // Liquid levels swept through the whole physics range
+      for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+        animations.setLevel(i, EffectsConfig::DIM_BRIGHTNESS +
+                               fmodf(step * 0.0137f + i * 0.11f, 1.0f - EffectsConfig::DIM_BRIGHTNESS));
+      }
+
+      for (float temperature : temperatures) {
+        animations.setTempoColorReactive(temperature != 0.0f);
+        animations.setTemperatureShift(temperature);
+
+        animations.render(0);
+        ReferenceRender::render(animations, palettes, 0, expected);
+        frames++;
+
+        for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+          uint32_t actual = leds.getColor(i);
+          pixels++;
+          if (actual == expected[i]) continue;
+
+          mismatched++;
+          for (int shift = 0; shift <= 16; shift += 8) {
+            int delta = abs((int)((actual >> shift) & 0xFF) - (int)((expected[i] >> shift) & 0xFF));
+            if (delta > maxDelta) maxDelta = delta;
+          }
+        }
+      }
+    }
+  }
+
+  animations.setTempoColorReactive(false);
+  animations.setTemperatureShift(0);
+  palettes.setCurrentPalette(0);
+  Serial.setMuted(false);
+
+  printf("  %-8s %6lu frames  %7lu pixels  %5lu differ (%.4f %%)  max delta %d\n",
+         name, frames, pixels, mismatched, 100.0 * mismatched / pixels, maxDelta);
+  return maxDelta;
+}
+
+void verifyGoldenFrames() {
+  benchSection("Golden frames (fixed-point vs float reference)");
+
+  CheckTally tally;
+
+  // 0.16 levels and 8.8 gains round within 1 LSB of the float path; the
+  // rainbow hue table adds 1 more
+  tally.expect(compareGoldenFrames(PATTERN_CUSTOM, "palette") <= 1, "palette frames within 1 LSB of the float reference");
+  tally.expect(compareGoldenFrames(PATTERN_RAINBOW_CYCLE, "rainbow") <= 2,
+               "rainbow frames within 2 LSB of the float reference");
+  printf("  %d passed, %d failed\n", tally.passed, tally.failed);
+}
+
+// Full frame (physics + compose + latch) on a strip of NumLeds pixels, with
+// the 8-bit frame sent as-is and through the gamma + dither output stage
+template <int NumLeds>
+void benchStripSize(const char* name) {
+  static Adafruit_NeoPixel sizedStrip(NumLeds, HardwareConfig::LED_PIN, NEO_GRB + NEO_KHZ800);
+  static LEDControllerT<NumLeds> sizedLeds(&sizedStrip);
+  static PaletteManagerT<NumLeds> sizedPalettes;
+  static AnimationEngineT<NumLeds> sizedAnimations(&sizedLeds, &sizedPalettes);
+
+  auto frame = [](unsigned long i) {
+    sizedAnimations.updateLiquidPhysics(swayAt(i * 10), true);
+    sizedAnimations.render(0);
+    sizedLeds.show();
+  };
+
+  Serial.setMuted(true);
+  sizedAnimations.setPattern(PATTERN_CUSTOM);
+
+  char label[48];
+  sizedLeds.setOutputStage(false);
+  snprintf(label, sizeof(label), "%s (8-bit)", name);
+  runBench(label, 20000, frame);
+
+  sizedLeds.setOutputStage(true);
+  snprintf(label, sizeof(label), "%s (gamma+dither)", name);
+  BenchResult dithered = runBench(label, 20000, frame);
+  printf("  %-36s %11.3f %% of the %lu us frame budget\n", "",
+         dithered.nsPerOp / (EffectsConfig::FRAME_INTERVAL_US * 10.0), EffectsConfig::FRAME_INTERVAL_US);
+}
+
+void benchScaling() {
+  benchSection("Frame cost by strip length");
+
+  benchStripSize<7>("frame @ 7 LEDs");
+  benchStripSize<60>("frame @ 60 LEDs");
+  benchStripSize<144>("frame @ 144 LEDs");
+  benchStripSize<300>("frame @ 300 LEDs");
+}
+
+// Slow fade of one channel through the dim range: counts how many distinct
+// time-averaged brightness steps reach the strip with and without dithering,
+// at the gamma the firmware ships with
+void verifyDimFade() {
+  benchSection("Dim fade resolution (0 - 5 % level, 50-frame average)");
+  CheckTally tally;
+
+  const int steps = 200;
+  const int framesPerStep = 50;
+  int distinctSteps[2] = {0, 0};
+
+  for (int pass = 0; pass < 2; pass++) {
+    bool dither = (pass == 1);
+    leds.setOutputStage(dither);
+
+    int distinct = 0;
+    double lastAverage = -1;
+    double maxError = 0;
+
+    for (int step = 0; step <= steps; step++) {
+      float level = 0.05f * step / steps;
+      // The 8-bit pass bypasses the gamma LUT
+      double target = 255.0 * (dither ? pow(level, EffectsConfig::OUTPUT_GAMMA) : level);
+      unsigned long sum = 0;
+
+      for (int f = 0; f < framesPerStep; f++) {
+        leds.setColorScaled(0, 0xFF0000, ColorMath::levelFromFloat(level));
+        leds.show();
+        sum += ColorMath::red(strip.getLatchedColor(0));
+      }
+
+      double average = (double)sum / framesPerStep;
+      double error = fabs(average - target);
+      if (error > maxError) maxError = error;
+      if (average != lastAverage) distinct++;
+      lastAverage = average;
+    }
+
+    distinctSteps[pass] = distinct;
+    printf("  %-14s %4d distinct steps, max error %.2f LSB\n",
+           dither ? "dithered" : "8-bit", distinct, maxError);
+  }
+  tally.expect(distinctSteps[1] > distinctSteps[0] * 4, "dithering resolves the fade below 1 LSB");
+
+  leds.setOutputStage(true);
+  leds.clear();
+  leds.show();
+  printf("  %d passed, %d failed\n", tally.passed, tally.failed);
+}
+
+// Frames held still at the shipped gamma: a sub-LSB level dithers for
+// EffectsConfig::DITHER_STEADY_FRAMES, then settles on the nearest 8-bit
+// values and stops latching the strip. A DIM_BRIGHTNESS tail must not blink
+// while it dithers, nor go dark once it settles.
+void verifyStaticFrame() {
+  benchSection("Static frame through the output stage");
+  CheckTally tally;
+
+  const ColorMath::Level level = ColorMath::levelFromFloat(0.013f);
+  const int held = EffectsConfig::DITHER_STEADY_FRAMES * 4;
+  unsigned long showsBefore = strip.getShowCount();
+  unsigned long settledAt = 0;
+  for (int f = 0; f < held; f++) {
+    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) leds.setColorScaled(i, 0xFF8040, level);
+    leds.show();
+    if (f == EffectsConfig::DITHER_STEADY_FRAMES) settledAt = strip.getShowCount();
+  }
+  unsigned long dithering = settledAt - showsBefore;
+  unsigned long afterSettling = strip.getShowCount() - settledAt;
+  uint32_t settled = strip.getLatchedColor(0);
+
+  // 255, 128 and 64 at 1.3 %: 3.31, 1.66 and 0.83 LSB before gamma
+  printf("  %d frames held: %lu latched while dithering, %lu after settling, settled at %06lX\n",
+         held, dithering, afterSettling, (unsigned long)settled);
+  tally.expect(dithering > 1, "a held sub-LSB level dithers first");
+  tally.expect(afterSettling == 0, "a static frame stops transmitting");
+  tally.expect(ColorMath::red(settled) > 0 && ColorMath::green(settled) > 0 && ColorMath::blue(settled) > 0,
+               "settles with every lit channel non-zero");
+  tally.expect(!leds.isDirty(), "settled frame is not dirty");
+
+  // Dim tail on a full channel: longest dark run while dithering, then settled
+  const int maxDarkFrames = 2;  // 40 ms at 50 FPS
+  const ColorMath::Level dim = ColorMath::levelFromFloat(EffectsConfig::DIM_BRIGHTNESS);
+  leds.clear();
+  leds.show();
+  int darkRun = 0;
+  int longestDark = 0;
+  int litFrames = 0;
+  for (int f = 0; f < held; f++) {
+    leds.setColorScaled(0, 0xFF0000, dim);
+    leds.show();
+    uint8_t red = ColorMath::red(strip.getLatchedColor(0));
+    darkRun = red ? 0 : darkRun + 1;
+    longestDark = max(longestDark, darkRun);
+    if (red) litFrames++;
+  }
+  uint8_t dimSettled = ColorMath::red(strip.getLatchedColor(0));
+  printf("  DIM_BRIGHTNESS tail   lit %d of %d frames, longest dark run %d, settled at %u\n",
+         litFrames, held, longestDark, dimSettled);
+  tally.expect(longestDark <= maxDarkFrames, "a dim tail is never dark for more than 2 frames in a row");
+  tally.expect(dimSettled > 0, "a dim tail settles to a non-zero value");
+
+  leds.clear();
+  leds.show();
+  printf("  %d passed, %d failed\n", tally.passed, tally.failed);
+}
+
+void benchMotion() {
+  benchSection("Motion");
+
+  // One 10 ms sample period per call: a single-sample FIFO drain
+  runBench("MPUSensor::read (1 sample)", 100000, [](unsigned long i) {
+    mpuModel.setAccel(swayAt(i), 0.0f, 1.0f);
+    HostClock::advanceMillis(10);
+    mpu.read();
+  });
+
+  // 100 ms between drains: 10 samples in one burst
+  runBench("MPUSensor::read (burst of 10)", 20000, [](unsigned long i) {
+    mpuModel.setAccel(swayAt(i), 0.0f, 1.0f);
+    HostClock::advanceMillis(100);
+    benchKeep(mpu.read());
+  });
+
+  runBench("GestureDetector::update", 200000, [](unsigned long i) {
+    mpu.setAccel(swayAt(i), mpu.accelY, mpu.accelZ);
+    gestures.update(mpu, millis());
+  });
+}
+
+// Replays scripted FIFO dumps through MPUSensor::read(): a one-sample tap
+// spike between two drains must reach GestureDetector
+void verifyFifoReplay() {
+  benchSection("FIFO replay");
+
+  static int taps = 0;
+  gestures.setOnTap([]() { taps++; });
+  Serial.setMuted(true);
+
+  // Settle the detector at rest, then replay dumps with a spike at different
+  // positions inside a 2-drain window
+  mpuModel.setAutoSample(false);
+  int detected = 0;
+  int latestOnly = 0;  // Spikes a read of only the newest sample would have seen
+  int scenarios = 0;
+  unsigned long delivered = 0;
+
+  for (int spikeAt = 0; spikeAt < 8; spikeAt++) {
+    std::vector<uint8_t> dump;
+    for (int i = 0; i < 20; i++) MPU6050Model::appendRecord(dump, 0, 0, 1, 0, 0, 0);
+    mpuModel.loadFifoDump(dump);
+    HostClock::advanceMillis(400);
+    mpu.read();
+
+    dump.clear();
+    for (int i = 0; i < 8; i++) {
+      MPU6050Model::appendRecord(dump, 0, 0, i == spikeAt ? 1.6f : 1.0f, 0, 0, 0);
+    }
+
+    taps = 0;
+    mpuModel.loadFifoDump(dump);
+    HostClock::advanceMillis(MPUConfig::READ_INTERVAL_MS);
+    delivered += mpu.read();
+
+    scenarios++;
+    if (taps == 1) detected++;
+    if (spikeAt == 7) latestOnly++;
+  }
+
+  mpuModel.setAutoSample(true);
+  mpuModel.clearFifo();
+  gestures.setOnTap(nullptr);
+  Serial.setMuted(false);
+
+  printf("  samples delivered     %lu of %d\n", delivered, scenarios * 8);
+  printf("  taps detected         %d of %d spikes (latest-sample polling: %d)\n",
+         detected, scenarios, latestOnly);
+}
+
+// Loop with WiFi-like jitter (0-15 ms busy per iteration) draining the FIFO:
+// sample timestamps from the data-ready interrupt vs the drain time the
+// timestamps used to come from
+void verifyInterruptTiming() {
+  benchSection("Data-ready interrupt timing (jittery loop, 5 s virtual)");
+
+  static unsigned long lastSampleMicros = 0;
+  static unsigned long minInterval = ~0UL;
+  static unsigned long maxInterval = 0;
+  static unsigned long timedSamples = 0;
+
+  mpu.setOnSample([](MPUSensor& sample, unsigned long sampleTime) {
+    if (lastSampleMicros != 0) {
+      unsigned long interval = sample.sampleMicros - lastSampleMicros;
+      minInterval = min(minInterval, interval);
+      maxInterval = max(maxInterval, interval);
+    }
+    lastSampleMicros = sample.sampleMicros;
+    timedSamples++;
+    gestures.update(sample, sampleTime);
+  });
+
+  Serial.setMuted(true);
+  mpu.read();  // Start from an empty FIFO
+  lastSampleMicros = 0;
+  unsigned long untimedBefore = mpu.getUntimedSampleCount();
+
+  unsigned long lastDrain = 0;
+  unsigned long minDrainGap = ~0UL;
+  unsigned long maxDrainGap = 0;
+  unsigned long drains = 0;
+  const uint64_t endTime = HostClock::getMicros() + 5000000ULL;
+
+  while (HostClock::getMicros() < endTime) {
+    HostClock::advanceMicros(random(0, 15000));  // WiFi, strip.show(), ...
+
+    if (mpu.isReadDue(millis())) {
+      unsigned long now = micros();
+      if (lastDrain != 0) {
+        minDrainGap = min(minDrainGap, now - lastDrain);
+        maxDrainGap = max(maxDrainGap, now - lastDrain);
+      }
+      lastDrain = now;
+      mpu.read();
+      drains++;
+    }
+  }
+
+  mpu.read();
+  mpu.setOnSample([](MPUSensor& sample, unsigned long sampleTime) {
+    gestures.update(sample, sampleTime);
+  });
+
+  // Lost pulses fall back to reconstructed timestamps
+  mpuModel.setInterruptLoss(true);
+  HostClock::advanceMillis(50);
+  unsigned long lost = mpu.read();
+  mpuModel.setInterruptLoss(false);
+  Serial.setMuted(false);
+
+  printf("  samples               %lu in %lu drains\n", timedSamples, drains);
+  printf("  drain interval        %lu - %lu us (loop jitter)\n", minDrainGap, maxDrainGap);
+  printf("  sample interval       %lu - %lu us (interrupt timestamps)\n", minInterval, maxInterval);
+  printf("  untimed samples       %lu (%lu read with INT pulses lost)\n",
+         mpu.getUntimedSampleCount() - untimedBefore, lost);
+}
+
+// Time the loop spends blocked on I2C at 100 vs 400 kHz, for a blocking
+// read() and for the split-phase drain (one burst per poll)
+void benchI2CClock() {
+  benchSection("I2C clock & split-phase drain (virtual time)");
+
+  const uint32_t clocks[] = {100000, MPUConfig::I2C_CLOCK_HZ};
+  Serial.setMuted(true);
+
+  for (uint32_t hz : clocks) {
+    Wire.setClock(hz);
+    mpu.read();
+
+    // 40-sample backlog (4 bursts): one blocking read() vs phase by phase
+    HostClock::advanceMillis(400);
+    uint64_t start = HostClock::getMicros();
+    mpu.read();
+    uint64_t blockingRead = HostClock::getMicros() - start;
+
+    HostClock::advanceMillis(400);
+    uint64_t longestStep = 0;
+    int steps = 0;
+    start = HostClock::getMicros();
+    bool more = mpu.startRead();
+    longestStep = HostClock::getMicros() - start;
+    steps++;
+    while (more) {
+      start = HostClock::getMicros();
+      more = !mpu.poll();
+      longestStep = max(longestStep, HostClock::getMicros() - start);
+      steps++;
+    }
+    mpu.completeRead();
+
+    // Steady state: drain every 20 ms for 3 s, then read the per-second figure
+    const uint64_t endTime = HostClock::getMicros() + 3000000ULL;
+    while (HostClock::getMicros() < endTime) {
+      HostClock::advanceMillis(MPUConfig::READ_INTERVAL_MS);
+      if (mpu.startRead()) {
+        while (!mpu.poll()) {}
+      }
+      mpu.completeRead();
+    }
+
+    printf("  %3lu kHz  blocking read(40) %5llu us | split: %d steps, longest %4llu us | steady %5lu us/s blocked\n",
+           (unsigned long)(hz / 1000), (unsigned long long)blockingRead, steps,
+           (unsigned long long)longestStep, mpu.getBusBlockedMicrosPerSecond());
+  }
+
+  Wire.setClock(MPUConfig::I2C_CLOCK_HZ);
+  Serial.setMuted(false);
+}
+
+// Mirrors captureStatus() in src/main.cpp (no battery monitor on the host)
+static void captureBenchStatus(DashboardStatus& status) {
+  status.liquid = true;
+  status.bpm = tempo.getBPM();
+  status.batteryPercent = 75;
+  status.palette = palettes.getCurrentIndex();
+  status.pattern = (int)animations.getPattern();
+  status.tilt = DashboardStatus::hundredths(mpu.getTiltAngle());
+  status.accelY = DashboardStatus::hundredths(mpu.getAccelY());
+  status.accelZ = DashboardStatus::hundredths(mpu.getAccelZ());
+  status.beat = beatSync.getIsActive();
+  for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    status.leds[i] = (uint8_t)constrain(DashboardStatus::hundredths(animations.getLEDBrightness(i)), 0, 100);
+    status.colors[i] = leds.getColor(i);
+  }
+}
+
+// Three dashboards for 60 s of virtual time (30 s swaying, 30 s at rest):
+// each polling /status every 100 ms vs the /events push of changed fields.
+// Heap figures cover firmware-side formatting only (not the TCP stack).
+void benchStatusLoad() {
+  benchSection("Dashboard status load (3 clients, 60 s virtual)");
+
+  const int clients = 3;
+  const unsigned long seconds = 60;
+  const uint64_t start = HostClock::getMicros();
+  const uint64_t endTime = start + seconds * 1000000ULL;
+  const unsigned long swayUntil = millis() + seconds * 500;
+
+  StatusPublisher publisher;
+  unsigned long pollRequests = 0, pollBytes = 0, pollAllocs = 0;
+  unsigned long pushMessages = 0, pushAllocs = 0;
+  unsigned long lastTick = millis();
+  char json[StatusPublisher::MAX_MESSAGE_SIZE];
+
+  Serial.setMuted(true);
+  while (HostClock::getMicros() < endTime) {
+    HostClock::advanceMillis(20);
+    unsigned long now = millis();
+    float tilt = now < swayUntil ? swayAt(now) : 0.3f;
+    mpuModel.setAccel(tilt, 0.0f, 1.0f);
+    mpu.read();
+    animations.updateLiquidPhysics(mpu.getTiltAngle(), gestures.getIsMoving());
+    animations.render(mpu.getTiltAngle());
+
+    if (now - lastTick < WiFiConfig::STATUS_UPDATE_INTERVAL_MS) continue;
+    lastTick = now;
+
+    // Before: every client fetches a full snapshot into a String
+    unsigned long before = heapAllocations;
+    for (int c = 0; c < clients; c++) {
+      DashboardStatus status;
+      captureBenchStatus(status);
+      StatusPublisher::formatFields(status, nullptr, json, sizeof(json));
+      String response(json);
+      pollBytes += response.length();
+      pollRequests++;
+    }
+    pollAllocs += heapAllocations - before;
+
+    // After: one capture per tick, broadcast only if something changed
+    before = heapAllocations;
+    DashboardStatus status;
+    captureBenchStatus(status);
+    if (publisher.format(status, now, json, sizeof(json)) > 0) {
+      pushMessages += clients;
+    }
+    pushAllocs += heapAllocations - before;
+  }
+  Serial.setMuted(false);
+
+  double elapsed = (HostClock::getMicros() - start) / 1000000.0;
+  printf("  polling /status       %.1f req/s, %.0f B/s, %.1f allocs/s\n",
+         pollRequests / elapsed, pollBytes / elapsed, pollAllocs / elapsed);
+  printf("  push /events          %.1f msg/s, %.0f B/s, %.1f allocs/s (%lu full, %lu ticks unchanged)\n",
+         pushMessages / elapsed, publisher.getBytesSent() * clients / elapsed, pushAllocs / elapsed,
+         publisher.getFullUpdatesSent(), publisher.getTicksUnchanged());
+}
+
+// One full status update per encoding: host cost and bytes on the wire.
+// The ArduinoJson path is the /status handler this replaced (runs when the
+// real library is on the include path, as in the native PlatformIO env).
+void benchStatusEncoding() {
+  benchSection("Status encoding (full snapshot)");
+
+  static DashboardStatus status;
+  captureBenchStatus(status);
+  status.tilt = -37;
+  status.accelZ = 98;
+  status.bpm = 128;
+  status.colors[2] = 0x12AB34;
+
+  static char json[StatusPublisher::MAX_MESSAGE_SIZE];
+  static StatusFrame::Frame frame;
+
+  runBench("StatusFrame::encode", 1000000, [](unsigned long i) {
+    status.tilt = (int)(i & 63);
+    StatusFrame::encode(status, frame);
+    benchKeep(frame);
+  });
+  runBench("StatusPublisher::formatFields", 200000, [](unsigned long i) {
+    status.tilt = (int)(i & 63);
+    benchKeep(StatusPublisher::formatFields(status, nullptr, json, sizeof(json)));
+  });
+
+  size_t jsonBytes = StatusPublisher::formatFields(status, nullptr, json, sizeof(json));
+#ifdef ARDUINOJSON_VERSION
+  static std::string arduinoJson;
+  runBench("ArduinoJson (StaticJsonDocument)", 200000, [](unsigned long i) {
+    StaticJsonDocument<512> doc;
+    doc["mode"] = status.liquid ? "liquid" : "tempo";
+    doc["bpm"] = status.bpm;
+    doc["batteryPercent"] = status.batteryPercent;
+    doc["currentPalette"] = status.palette;
+    doc["currentPattern"] = status.pattern;
+    doc["tiltAngle"] = (i & 63) / 100.0f;
+    doc["accelY"] = status.accelY / 100.0f;
+    doc["accelZ"] = status.accelZ / 100.0f;
+    doc["beat"] = status.beat;
+    JsonArray levels = doc.createNestedArray("leds");
+    for (int led = 0; led < HardwareConfig::NUM_LEDS; led++) levels.add(status.leds[led] / 100.0f);
+    arduinoJson.clear();
+    serializeJson(doc, arduinoJson);
+  });
+  printf("  bytes per update      binary %zu | JSON %zu | ArduinoJson %u (no colors in either JSON)\n",
+         StatusFrame::SIZE, jsonBytes, (unsigned)arduinoJson.size());
+#else
+  printf("  ArduinoJson           not on the include path - skipped\n");
+  printf("  bytes per update      binary %zu | JSON %zu (no colors in the JSON)\n", StatusFrame::SIZE, jsonBytes);
+#endif
+
+  // Offsets the dashboard decoder reads
+  status.tilt = -37;
+  StatusFrame::encode(status, frame);
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&frame);
+  const int n = HardwareConfig::NUM_LEDS;
+  bool layout = bytes[0] == 'C' && bytes[1] == 'T' && bytes[2] == StatusFrame::VERSION &&
+                (bytes[4] | bytes[5] << 8) == 128 &&
+                (int16_t)(bytes[10] | bytes[11] << 8) == -37 &&
+                (int16_t)(bytes[14] | bytes[15] << 8) == 98 &&
+                bytes[9] == n && bytes[16 + 2] == status.leds[2] &&
+                bytes[16 + n + 6] == 0x12 && bytes[16 + n + 7] == 0xAB && bytes[16 + n + 8] == 0x34 &&
+                StatusFrame::SIZE == (size_t)(16 + 4 * n);
+  printf("  frame layout          %s\n", layout ? "matches the documented offsets" : "FAIL: offsets moved");
+
+  // Longest strip, every field at its widest: the full snapshot still fits
+  typedef StatusPublisherT<300> WidePublisher;
+  static WidePublisher::Status wide;
+  wide.bpm = wide.batteryPercent = wide.palette = wide.pattern = INT_MIN;
+  wide.tilt = wide.accelY = wide.accelZ = INT_MIN + 1;
+  memset(wide.leds, 255, sizeof(wide.leds));
+  static char wideJson[WidePublisher::MAX_MESSAGE_SIZE];
+  WidePublisher widePublisher;
+  size_t wideBytes = widePublisher.format(wide, 0, wideJson, sizeof(wideJson));
+  bool wideFits = wideBytes > 0 && wideBytes < sizeof(wideJson) && wideJson[wideBytes - 1] == '}';
+  printf("  300 LEDs, widest      %zu of %zu bytes (%s)\n", wideBytes, sizeof(wideJson),
+         wideFits ? "full snapshot fits" : "FAIL: truncated");
+}
+
+// Page weight of GET / before and after the gzip/ETag change, in bytes and
+// full-size TCP segments over the softAP; also catches a stale DashboardAsset.h
+void reportDashboardAsset() {
+  benchSection("Dashboard page");
+
+  const size_t mss = 1460;
+  size_t html = strlen(dashboard_html);
+  printf("  plain HTML            %zu bytes (%zu segments)\n", html, (html + mss - 1) / mss);
+  printf("  gzip                  %zu bytes (%zu segments, %.0f %% of plain)\n", DashboardAsset::GZIP_SIZE,
+         (DashboardAsset::GZIP_SIZE + mss - 1) / mss, 100.0 * DashboardAsset::GZIP_SIZE / html);
+  printf("  reload, ETag match    304, headers only\n");
+  if (html != DashboardAsset::HTML_SIZE) {
+    printf("  FAIL: DashboardAsset.h is stale (%zu bytes embedded) - run scripts/embed_dashboard.py\n",
+           DashboardAsset::HTML_SIZE);
+  }
+}
+
+void benchTempo() {
+  benchSection("Tempo");
+
+  runBench("TempoDetector::addTap", 200000, [](unsigned long i) {
+    tempo.addTap(i * 500);
+    benchKeep(tempo.getBPM());
+  });
+
+  beatSync.start(500, 0);
+  runBench("BeatSynchronizer::update", 200000, [](unsigned long i) {
+    beatSync.update(i);
+  });
+}
+
+void benchCommands() {
+  benchSection("Commands");
+
+  // The full command set, so lookups see a realistic table
+  cmdParser.registerCommands(ParserChecks::commands, ParserChecks::NAME_COUNT);
+
+  unsigned long allocationsBefore = heapAllocations;
+  BenchResult hit = runBench("CommandParser::parse (brightness=0.5)", 1000000, [](unsigned long) {
+    cmdParser.parse("brightness=0.5");
+  });
+  BenchResult miss = runBench("CommandParser::parse (unknown)", 1000000, [](unsigned long) {
+    cmdParser.parse("brightnes=0.5");
+  });
+  unsigned long allocations = heapAllocations - allocationsBefore;
+
+  printf("  throughput            %.2f M commands/s (hit), %.2f M/s (unknown)\n",
+         1000.0 / hit.nsPerOp, 1000.0 / miss.nsPerOp);
+  printf("  heap allocations      %lu over %lu parses\n", allocations,
+         hit.iterations + miss.iterations + (hit.iterations + miss.iterations) / 10 + 2);
+
+  verifyCommandParser(cmdParser);
+}
+
+// Runs the liquid-mode work of the sensor and render tasks in src/main.cpp
+// from one loop and reports how long each iteration takes in virtual time.
+// Bus and LED wire time are modelled by the shims; firmware compute is
+// charged at host speed (ChargedCompute, so far below what the ESP32-C3
+// takes) inside the same stage timers and task-load brackets the tasks use.
+// A dashboard command arrives once a second.
+void simulateLoop() {
+  benchSection("Simulated loop (liquid mode, virtual time)");
+  CheckTally tally;
+
+  const unsigned long simulatedMs = 10000;
+  const uint64_t endTime = HostClock::getMicros() + simulatedMs * 1000ULL;
+  const unsigned long swayUntil = millis() + simulatedMs / 2;
+  unsigned long iterations = 0;
+  uint64_t worst = 0;
+  uint64_t busy = 0;
+  unsigned long lastMPURead = millis();
+  unsigned long lastCommand = millis();
+  RenderScheduler renderer;
+  TaskStats sensorStats("sensor", TaskConfig::SENSOR_PRIORITY);
+  TaskStats renderStats("render", TaskConfig::RENDER_PRIORITY);
+  static StageTimings stageTimings;
+  static CommandQueue<WiFiConfig::COMMAND_QUEUE_SLOTS> webCommands;
+  stageTimings.reset();
+
+  // Sensor task side of every FIFO sample, as setupGestures() registers it
+  mpu.setOnSample([](MPUSensor& sample, unsigned long sampleTime) {
+    ScopedStageTimer timer(stageTimings, Stage::GESTURES);
+    ChargedCompute compute;
+    gestures.update(sample, sampleTime);
+  });
+
+  Serial.setMuted(true);
+  strip.resetRecording();
+  leds.resetStats();
+  Wire.resetStats();
+  unsigned long samplesBefore = mpu.getSamplesRead();
+  unsigned long overflowsBefore = mpu.getOverflowCount();
+
+  while (HostClock::getMicros() < endTime) {
+    uint64_t start = HostClock::getMicros();
+    unsigned long currentTime = millis();
+
+    // Slow sway for the first half, then held still
+    float tilt = currentTime < swayUntil ? swayAt(currentTime) : 0.3f;
+    mpuModel.setAccel(tilt, 0.0f, 1.0f);
+
+    if (currentTime - lastCommand >= 1000) {
+      lastCommand = currentTime;
+      webCommands.push(CommandText("brightness=0.5"));
+    }
+
+    if (!mpu.isReadInProgress() && mpu.isReadDue(currentTime)) {
+      sensorStats.beginWork(micros());
+      ScopedStageTimer timer(stageTimings, Stage::SENSOR_DRAIN);
+      mpu.startRead();
+      lastMPURead = currentTime;
+      sensorStats.endWork(micros());
+    }
+
+    if (renderer.frameDue(micros())) {
+      renderStats.beginWork(micros());
+      renderer.beginFrame(micros());
+      {
+        ScopedStageTimer frameTimer(stageTimings, Stage::FRAME);
+        {
+          ScopedStageTimer timer(stageTimings, Stage::COMMANDS);
+          ChargedCompute compute;
+          webCommands.apply(cmdParser, SystemConfig::COMMANDS_PER_FRAME);
+        }
+        {
+          ScopedStageTimer timer(stageTimings, Stage::RENDER);
+          ChargedCompute compute;
+          animations.updateLiquidPhysics(mpu.getTiltAngle(), gestures.getIsMoving());
+          animations.render(mpu.getTiltAngle());
+        }
+        {
+          ScopedStageTimer timer(stageTimings, Stage::SHOW);
+          ChargedCompute compute;
+          leds.show();
+        }
+        renderer.endFrame(micros());
+      }
+      renderStats.endWork(micros());
+    }
+
+    if (mpu.isReadInProgress()) {
+      sensorStats.beginWork(micros());
+      ScopedStageTimer timer(stageTimings, Stage::SENSOR_DRAIN);
+      if (mpu.poll()) mpu.completeRead();
+      sensorStats.endWork(micros());
+    }
+
+    uint64_t elapsed = HostClock::getMicros() - start;
+    busy += elapsed;
+    if (elapsed > worst) worst = elapsed;
+    iterations++;
+
+    // Sleep until the next frame or drain (at least 1 us, so the loop always
+    // moves on now that nothing else charges a fixed cost per wakeup)
+    unsigned long untilFrameUs = renderer.getTimeUntilNextFrame(micros());
+    unsigned long sinceMPURead = millis() - lastMPURead;
+    unsigned long untilMPUReadUs = 0;
+    if (sinceMPURead < (unsigned long)MPUConfig::READ_INTERVAL_MS) {
+      untilMPUReadUs = (MPUConfig::READ_INTERVAL_MS - sinceMPURead) * 1000UL;
+    }
+    if (!mpu.isReadInProgress()) delayMicroseconds(max(1UL, min(untilFrameUs, untilMPUReadUs)));
+  }
+
+  mpu.setOnSample([](MPUSensor& sample, unsigned long sampleTime) {
+    gestures.update(sample, sampleTime);
+  });
+  Serial.setMuted(false);
+
+  printf("  simulated time        %lu ms\n", simulatedMs);
+  printf("  loop wakeups          %lu\n", iterations);
+  printf("  avg loop latency      %.1f us\n", (double)busy / iterations);
+  printf("  worst loop latency    %llu us\n", (unsigned long long)worst);
+  printf("  busy fraction         %.1f %%\n", 100.0 * busy / (simulatedMs * 1000.0));
+  printf("  frames rendered       %lu (avg %lu us, max %lu us / %lu us budget)\n",
+         renderer.getFramesRendered(), renderer.getAverageFrameTime(),
+         renderer.getMaxFrameTime(), renderer.getFrameInterval());
+  printf("  frames submitted      %lu\n", leds.getFramesSubmitted());
+  printf("  frames transmitted    %lu (%lu changed pixels)\n", leds.getFramesTransmitted(), leds.getPixelsTransmitted());
+  printf("  strip.show() latches  %lu\n", strip.getShowCount());
+  printf("  I2C transactions      %lu (%lu bytes @ %lu kHz)\n", Wire.getTransactionCount(),
+         Wire.getBytesTransferred(), (unsigned long)(Wire.getClock() / 1000));
+  printf("  I2C blocked           %lu us/s (longest step %lu us)\n",
+         mpu.getBusBlockedMicrosPerSecond(), mpu.getLongestBusStepMicros());
+  printf("  sensor samples        %lu (%lu FIFO overflows)\n", mpu.getSamplesRead() - samplesBefore, mpu.getOverflowCount() - overflowsBefore);
+  const LatencyHistogram& drains = stageTimings.get(Stage::SENSOR_DRAIN);
+  const LatencyHistogram& frames = stageTimings.get(Stage::FRAME);
+  printf("  task load (whole run) sensor %.1f %% (longest %lu us), render %.1f %% (longest %lu us)\n",
+         drains.getTotal() / (simulatedMs * 10.0), (unsigned long)drains.getMax(),
+         frames.getTotal() / (simulatedMs * 10.0), (unsigned long)frames.getMax());
+  printf("  task load (last 1 s)  sensor %.1f %% (longest %lu us), render %.1f %% (longest %lu us), held still\n",
+         sensorStats.getBusyMicrosPerSecond() / 10000.0, sensorStats.getLongestStepMicros(),
+         renderStats.getBusyMicrosPerSecond() / 10000.0, renderStats.getLongestStepMicros());
+  stageTimings.print();
+
+  // The frame timer wraps the commands, render and show timers and nothing
+  // else that takes virtual time, so their sums must agree
+  uint64_t frameTotal = stageTimings.get(Stage::FRAME).getTotal();
+  uint64_t partsTotal = stageTimings.get(Stage::COMMANDS).getTotal() + stageTimings.get(Stage::RENDER).getTotal() +
+                        stageTimings.get(Stage::SHOW).getTotal();
+  printf("  frame vs parts        %llu us vs %llu us (commands + render + show)\n",
+         (unsigned long long)frameTotal, (unsigned long long)partsTotal);
+  tally.expect(stageTimings.get(Stage::RENDER).getMax() > 0, "render stage measures compute");
+  tally.expect(stageTimings.get(Stage::GESTURES).getCount() == mpu.getSamplesRead() - samplesBefore,
+               "gestures timed once per sample");
+  tally.expect(stageTimings.get(Stage::COMMANDS).getCount() == renderer.getFramesRendered(),
+               "commands timed once per frame");
+  tally.expect(partsTotal <= frameTotal && frameTotal - partsTotal <= frameTotal / 50,
+               "render + show + commands account for the frame time");
+  tally.expect(renderStats.getIterations() == renderer.getFramesRendered(), "render task load brackets every frame");
+  printf("  %d passed, %d failed\n", tally.passed, tally.failed);
+}
+
+int main() {
+  HostClock::reset();
+  randomSeed(42);
+
+  Wire.attach(MPUConfig::MPU_ADDRESS, &mpuModel);
+  mpuModel.connectInterrupt(HardwareConfig::MPU_INT_PIN);
+  Serial.setMuted(true);
+  mpu.begin();
+  mpu.setOnSample([](MPUSensor& sample, unsigned long sampleTime) {
+    gestures.update(sample, sampleTime);
+  });
+  strip.begin();
+  Serial.setMuted(false);
+
+  printf("Ctenophore host benchmarks (%d LEDs)\n", HardwareConfig::NUM_LEDS);
+
+  benchRender();
+  benchHueConversion();
+  verifyGoldenFrames();
+  benchScaling();
+  verifyDimFade();
+  verifyStaticFrame();
+  benchMotion();
+  verifyFifoReplay();
+  verifyRingBuffer();
+  verifyInterruptTiming();
+  benchI2CClock();
+  benchStatusLoad();
+  benchStatusEncoding();
+  verifySnapshots();
+  reportDashboardAsset();
+  benchTempo();
+  benchCommands();
+  verifyRequestBody();
+  verifyStageTimings();
+  verifyRunningWindow();
+  verifyOrientation(mpu, mpuModel, gestures);
+  verifyGyroCalibration(mpuModel);
+  verifyRotationTiming(mpu, mpuModel, gestures);
+  verifyGestureRecognizer();
+  simulateLoop();
+
+  return 0;
+}
@@ -0,0 +1,99 @@
+#ifndef HOST_ADAFRUIT_NEOPIXEL_H
+#define HOST_ADAFRUIT_NEOPIXEL_H
+
+// Host-side recording NeoPixel strip.
+// Keeps the pixel buffer like the real driver, counts latches and keeps a copy
+// of the last transmitted frame. show() charges WS2812 wire time (30 us per
+// pixel plus the reset latch) to the virtual clock.
+
+#include "Arduino.h"
+#include <vector>
+
+#define NEO_GRB     ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_RGB     ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_KHZ800  0x0000
+
+typedef uint16_t neoPixelType;
+
+class Adafruit_NeoPixel {
+private:
+  uint16_t numLEDs;
+  int16_t pin;
+  uint8_t brightness = 0;  // Stored +1 like the real driver (0 = full)
+  std::vector<uint32_t> pixels;
+  std::vector<uint32_t> latched;
+
+  // Recording
+  unsigned long showCount = 0;
+  bool recordFrames = false;
+  std::vector<std::vector<uint32_t>> history;
+
+  static constexpr uint32_t MICROS_PER_PIXEL = 30;
+  static constexpr uint32_t LATCH_MICROS = 300;
+
+  uint32_t scale(uint32_t color) const {
+    if (!brightness) return color;
+    uint8_t r = (uint8_t)((((color >> 16) & 0xFF) * brightness) >> 8);
+    uint8_t g = (uint8_t)((((color >> 8) & 0xFF) * brightness) >> 8);
+    uint8_t b = (uint8_t)(((color & 0xFF) * brightness) >> 8);
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+
+public:
+  Adafruit_NeoPixel(uint16_t n, int16_t p = 6, neoPixelType type = NEO_GRB + NEO_KHZ800)
+    : numLEDs(n), pin(p), pixels(n, 0), latched(n, 0) {
+    (void)type;
+  }
+
+  void begin() {}
+
+  void show() {
+    for (uint16_t i = 0; i < numLEDs; i++) {
+      latched[i] = scale(pixels[i]);
+    }
+    showCount++;
+    if (recordFrames) history.push_back(latched);
+    HostClock::advanceMicros((uint64_t)numLEDs * MICROS_PER_PIXEL + LATCH_MICROS);
+  }
+
+  bool canShow() const { return true; }
+
+  void setPixelColor(uint16_t n, uint32_t c) {
+    if (n < numLEDs) pixels[n] = c;
+  }
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+    setPixelColor(n, Color(r, g, b));
+  }
+
+  uint32_t getPixelColor(uint16_t n) const {
+    return n < numLEDs ? pixels[n] : 0;
+  }
+
+  void fill(uint32_t c = 0, uint16_t first = 0, uint16_t count = 0) {
+    if (first >= numLEDs) return;
+    uint16_t end = (count == 0 || first + count > numLEDs) ? numLEDs : first + count;
+    for (uint16_t i = first; i < end; i++) pixels[i] = c;
+  }
+
+  void clear() { fill(0); }
+
+  // Brightness is stored +1 so that 255 means "no scaling"
+  void setBrightness(uint8_t b) { brightness = b + 1; }
+  uint8_t getBrightness() const { return brightness - 1; }
+
+  uint16_t numPixels() const { return numLEDs; }
+  int16_t getPin() const { return pin; }
+
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+
+  // ----- Host controls -----
+  unsigned long getShowCount() const { return showCount; }
+  uint32_t getLatchedColor(uint16_t n) const { return n < numLEDs ? latched[n] : 0; }
+  void setRecordFrames(bool enable) { recordFrames = enable; }
+  const std::vector<std::vector<uint32_t>>& getHistory() const { return history; }
+  void resetRecording() { showCount = 0; history.clear(); }
+};
+
+#endif // HOST_ADAFRUIT_NEOPIXEL_H
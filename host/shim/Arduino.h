@@ -0,0 +1,319 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Host-side stand-in for the ESP32 Arduino core.
+// Only the subset used by the modules in src/ is provided. Time comes from a
+// virtual clock that the simulation drives explicitly, so runs are repeatable.
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// Match the ESP32 core: std overloads instead of the classic AVR macros
+using std::abs;
+using std::min;
+using std::max;
+using std::isinf;
+using std::isnan;
+
+#define PI          3.1415926535897932384626433832795
+#define HALF_PI     1.5707963267948966192313216916398
+#define TWO_PI      6.283185307179586476925286766559
+#define DEG_TO_RAD  0.017453292519943295769236907684886
+#define RAD_TO_DEG  57.295779513082320876798154814105
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define PROGMEM
+#define IRAM_ATTR
+#define F(str) (str)
+
+#define INPUT   0x01
+#define OUTPUT  0x03
+#define LOW     0x0
+#define HIGH    0x1
+
+// Xiao ESP32-C3 analog pin mapping
+#define A0 2
+
+// ===== VIRTUAL CLOCK =====
+// millis()/micros() read this clock; nothing advances it except the host
+// program (and the peripheral shims, which charge their bus time to it).
+// Simulated hardware can schedule events on it (sample clocks, interrupt
+// lines); advancing the clock runs every event that falls due, in order, with
+// the clock set to the event's own time.
+namespace HostClock {
+  inline uint64_t nowMicros = 0;
+  inline std::multimap<uint64_t, std::function<void()>> events;
+
+  inline void reset(uint64_t micros = 0) {
+    nowMicros = micros;
+    events.clear();
+  }
+
+  inline void schedule(uint64_t atMicros, std::function<void()> event) {
+    events.emplace(atMicros, event);
+  }
+
+  inline void advanceMicros(uint64_t us) {
+    uint64_t target = nowMicros + us;
+    while (!events.empty() && events.begin()->first <= target) {
+      auto next = events.begin();
+      std::function<void()> event = next->second;
+      nowMicros = std::max(nowMicros, next->first);
+      events.erase(next);
+      event();
+    }
+    nowMicros = std::max(nowMicros, target);
+  }
+
+  inline void advanceMillis(uint64_t ms) { advanceMicros(ms * 1000ULL); }
+  inline uint64_t getMicros() { return nowMicros; }
+}
+
+inline unsigned long millis() { return (unsigned long)(HostClock::nowMicros / 1000ULL); }
+inline unsigned long micros() { return (unsigned long)HostClock::nowMicros; }
+inline void delay(unsigned long ms) { HostClock::advanceMillis(ms); }
+inline void delayMicroseconds(unsigned int us) { HostClock::advanceMicros(us); }
+inline void yield() {}
+
+// ===== GPIO / ADC =====
+namespace HostPins {
+  inline int analogValues[32] = {0};
+  inline int digitalValues[32] = {0};
+
+  inline void setAnalog(int pin, int value) {
+    if (pin >= 0 && pin < 32) analogValues[pin] = value;
+  }
+}
+
+inline void pinMode(int, int) {}
+inline void digitalWrite(int pin, int value) {
+  if (pin >= 0 && pin < 32) HostPins::digitalValues[pin] = value;
+}
+inline int digitalRead(int pin) {
+  return (pin >= 0 && pin < 32) ? HostPins::digitalValues[pin] : LOW;
+}
+inline int analogRead(int pin) {
+  return (pin >= 0 && pin < 32) ? HostPins::analogValues[pin] : 0;
+}
+
+// ===== INTERRUPTS =====
+// Simulated peripherals raise a pin with HostInterrupts::trigger(); the
+// attached handler runs synchronously (like an ISR preempting loop()).
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+namespace HostInterrupts {
+  struct Handler {
+    void (*plain)();
+    void (*withArg)(void*);
+    void* arg;
+  };
+
+  inline Handler handlers[32] = {};
+  inline bool enabled = true;
+  inline unsigned long triggered = 0;
+
+  inline void trigger(int pin) {
+    if (pin < 0 || pin >= 32 || !enabled) return;
+    triggered++;
+    if (handlers[pin].plain) handlers[pin].plain();
+    if (handlers[pin].withArg) handlers[pin].withArg(handlers[pin].arg);
+  }
+}
+
+inline int digitalPinToInterrupt(int pin) { return pin; }
+inline void attachInterrupt(int pin, void (*handler)(), int) {
+  if (pin >= 0 && pin < 32) HostInterrupts::handlers[pin] = {handler, nullptr, nullptr};
+}
+inline void attachInterruptArg(int pin, void (*handler)(void*), void* arg, int) {
+  if (pin >= 0 && pin < 32) HostInterrupts::handlers[pin] = {nullptr, handler, arg};
+}
+inline void detachInterrupt(int pin) {
+  if (pin >= 0 && pin < 32) HostInterrupts::handlers[pin] = {nullptr, nullptr, nullptr};
+}
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+// ===== RANDOM =====
+// Deterministic LCG so sparkle effects replay identically between runs
+namespace HostRandom {
+  inline uint32_t state = 1;
+}
+
+inline void randomSeed(unsigned long seed) { HostRandom::state = seed ? seed : 1; }
+inline long random(long howBig) {
+  if (howBig <= 0) return 0;
+  HostRandom::state = HostRandom::state * 1103515245UL + 12345UL;
+  return (long)((HostRandom::state >> 16) % (uint32_t)howBig);
+}
+inline long random(long howSmall, long howBig) {
+  if (howSmall >= howBig) return howSmall;
+  return howSmall + random(howBig - howSmall);
+}
+
+// ===== STRING =====
+// Thin wrapper over std::string with the Arduino String API
+class String {
+private:
+  std::string str;
+
+  static std::string formatFloat(double value, unsigned char decimals) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, value);
+    return buf;
+  }
+
+public:
+  String() {}
+  String(const char* s) : str(s ? s : "") {}
+  String(const std::string& s) : str(s) {}
+  String(char c) : str(1, c) {}
+  String(int value) : str(std::to_string(value)) {}
+  String(unsigned int value) : str(std::to_string(value)) {}
+  String(long value) : str(std::to_string(value)) {}
+  String(unsigned long value) : str(std::to_string(value)) {}
+  String(float value, unsigned char decimals = 2) : str(formatFloat(value, decimals)) {}
+  String(double value, unsigned char decimals = 2) : str(formatFloat(value, decimals)) {}
+
+  unsigned int length() const { return str.length(); }
+  bool isEmpty() const { return str.empty(); }
+  const char* c_str() const { return str.c_str(); }
+  void reserve(unsigned int size) { str.reserve(size); }
+
+  char charAt(unsigned int index) const { return index < str.length() ? str[index] : 0; }
+  char operator[](unsigned int index) const { return charAt(index); }
+
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t pos = str.find(c, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+  }
+  int indexOf(const String& s, unsigned int from = 0) const {
+    size_t pos = str.find(s.str, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+  }
+
+  String substring(unsigned int from) const {
+    return from >= str.length() ? String() : String(str.substr(from));
+  }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= str.length()) return String();
+    return String(str.substr(from, to - from));
+  }
+
+  bool startsWith(const String& prefix) const {
+    return str.compare(0, prefix.str.length(), prefix.str) == 0;
+  }
+  bool endsWith(const String& suffix) const {
+    return str.length() >= suffix.str.length() &&
+           str.compare(str.length() - suffix.str.length(), suffix.str.length(), suffix.str) == 0;
+  }
+  bool equals(const String& other) const { return str == other.str; }
+
+  void trim() {
+    size_t start = str.find_first_not_of(" \t\r\n");
+    if (start == std::string::npos) { str.clear(); return; }
+    size_t end = str.find_last_not_of(" \t\r\n");
+    str = str.substr(start, end - start + 1);
+  }
+  void toLowerCase() { for (char& c : str) c = (char)tolower((unsigned char)c); }
+  void toUpperCase() { for (char& c : str) c = (char)toupper((unsigned char)c); }
+
+  long toInt() const { return atol(str.c_str()); }
+  float toFloat() const { return (float)atof(str.c_str()); }
+
+  bool concat(const String& s) { str += s.str; return true; }
+  String& operator+=(const String& s) { str += s.str; return *this; }
+  String& operator+=(const char* s) { str += s; return *this; }
+  String& operator+=(char c) { str += c; return *this; }
+
+  bool operator==(const String& other) const { return str == other.str; }
+  bool operator==(const char* other) const { return str == (other ? other : ""); }
+  bool operator!=(const String& other) const { return str != other.str; }
+  bool operator!=(const char* other) const { return !(*this == other); }
+
+  friend String operator+(const String& a, const String& b) { return String(a.str + b.str); }
+  friend String operator+(const char* a, const String& b) { return String(std::string(a) + b.str); }
+  friend String operator+(const String& a, const char* b) { return String(a.str + b); }
+};
+
+// ===== SERIAL =====
+// Prints to stdout (mutable for benchmarks); input is injected by the host
+class HostSerial {
+private:
+  std::string input;
+  bool muted = false;
+
+public:
+  void begin(unsigned long) {}
+  void setMuted(bool mute) { muted = mute; }
+  bool isMuted() const { return muted; }
+
+  // Queue text as if it had been typed into the serial monitor
+  void inject(const char* text) { input += text; }
+
+  int available() const { return (int)input.size(); }
+  int read() {
+    if (input.empty()) return -1;
+    int c = (unsigned char)input[0];
+    input.erase(0, 1);
+    return c;
+  }
+  String readString() {
+    String result(input);
+    input.clear();
+    return result;
+  }
+  String readStringUntil(char terminator) {
+    size_t pos = input.find(terminator);
+    std::string line = input.substr(0, pos);
+    input.erase(0, pos == std::string::npos ? std::string::npos : pos + 1);
+    return String(line);
+  }
+
+  size_t write(const char* s) {
+    if (muted || !s) return 0;
+    return fwrite(s, 1, strlen(s), stdout);
+  }
+  size_t write(const uint8_t* data, size_t length) {
+    if (muted || !data) return 0;
+    return fwrite(data, 1, length, stdout);
+  }
+
+  size_t print(const char* s) { return write(s); }
+  size_t print(const String& s) { return write(s.c_str()); }
+  size_t print(char c) { char buf[2] = {c, 0}; return write(buf); }
+  size_t print(int value) { return print(String(value)); }
+  size_t print(unsigned int value) { return print(String(value)); }
+  size_t print(long value) { return print(String(value)); }
+  size_t print(unsigned long value) { return print(String(value)); }
+  size_t print(double value, int digits = 2) { return print(String(value, (unsigned char)digits)); }
+
+  template <typename T>
+  size_t println(const T& value) { size_t n = print(value); return n + write("\n"); }
+  size_t println(double value, int digits) { size_t n = print(value, digits); return n + write("\n"); }
+  size_t println() { return write("\n"); }
+
+  template <typename... Args>
+  size_t printf(const char* format, Args... args) {
+    char buf[256];
+    snprintf(buf, sizeof(buf), format, args...);
+    return write(buf);
+  }
+};
+
+inline HostSerial Serial;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,73 @@
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+// Host-side stand-in for the ESP32 Preferences (NVS) library.
+// Values live in a process-wide map keyed by namespace and key, so they
+// outlive the Preferences object like flash outlives a reboot. Writes are
+// counted to keep an eye on flash wear.
+
+#include "Arduino.h"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace HostFlash {
+  inline std::map<std::string, std::vector<uint8_t>> entries;
+  inline unsigned long writes = 0;
+
+  inline void erase() { entries.clear(); }
+}
+
+class Preferences {
+private:
+  std::string space;
+  bool readOnly = true;
+  bool opened = false;
+
+  std::string keyFor(const char* key) const { return space + "/" + key; }
+
+public:
+  bool begin(const char* name, bool openReadOnly = false) {
+    space = name;
+    readOnly = openReadOnly;
+    opened = true;
+    return true;
+  }
+
+  void end() { opened = false; }
+
+  size_t putBytes(const char* key, const void* value, size_t length) {
+    if (!opened || readOnly) return 0;
+    const uint8_t* bytes = static_cast<const uint8_t*>(value);
+    HostFlash::entries[keyFor(key)].assign(bytes, bytes + length);
+    HostFlash::writes++;
+    return length;
+  }
+
+  size_t getBytesLength(const char* key) const {
+    auto entry = HostFlash::entries.find(keyFor(key));
+    return opened && entry != HostFlash::entries.end() ? entry->second.size() : 0;
+  }
+
+  size_t getBytes(const char* key, void* buffer, size_t maxLength) const {
+    auto entry = HostFlash::entries.find(keyFor(key));
+    if (!opened || entry == HostFlash::entries.end() || entry->second.size() > maxLength) return 0;
+    memcpy(buffer, entry->second.data(), entry->second.size());
+    return entry->second.size();
+  }
+
+  bool remove(const char* key) {
+    if (!opened || readOnly) return false;
+    return HostFlash::entries.erase(keyFor(key)) > 0;
+  }
+
+  bool clear() {
+    if (!opened || readOnly) return false;
+    for (auto entry = HostFlash::entries.begin(); entry != HostFlash::entries.end();) {
+      entry = entry->first.compare(0, space.size() + 1, space + "/") == 0 ? HostFlash::entries.erase(entry) : std::next(entry);
+    }
+    return true;
+  }
+};
+
+#endif // HOST_PREFERENCES_H
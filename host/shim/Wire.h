@@ -0,0 +1,179 @@
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+// Host-side scripted I2C bus.
+// Devices are attached by address; the first byte written after
+// beginTransmission() selects the register pointer, reads auto-increment it
+// unless the device reports the register as a stream (e.g. a FIFO port).
+// Every transfer charges its wire time to the virtual clock.
+
+#include "Arduino.h"
+
+// Simulated I2C peripheral
+class HostI2CDevice {
+public:
+  virtual ~HostI2CDevice() {}
+  virtual uint8_t readRegister(uint8_t reg) = 0;
+  virtual void writeRegister(uint8_t reg, uint8_t value) = 0;
+
+  // Registers that are read repeatedly without advancing the pointer
+  virtual bool isStreamRegister(uint8_t reg) const { (void)reg; return false; }
+};
+
+// Plain 256-byte register file
+class HostRegisterDevice : public HostI2CDevice {
+protected:
+  uint8_t registers[256] = {0};
+
+public:
+  uint8_t readRegister(uint8_t reg) override { return registers[reg]; }
+  void writeRegister(uint8_t reg, uint8_t value) override { registers[reg] = value; }
+
+  void setRegister16(uint8_t reg, int16_t value) {
+    registers[reg] = (uint8_t)((uint16_t)value >> 8);
+    registers[(uint8_t)(reg + 1)] = (uint8_t)(value & 0xFF);
+  }
+};
+
+class TwoWire {
+private:
+  static constexpr int MAX_DEVICES = 8;
+  static constexpr int BUFFER_SIZE = 128;
+
+  struct Slot {
+    uint8_t address;
+    HostI2CDevice* device;
+  };
+
+  Slot devices[MAX_DEVICES];
+  int deviceCount = 0;
+
+  uint32_t clockHz = 100000;
+  bool chargeBusTime = true;
+
+  // Current write transaction
+  uint8_t txAddress = 0;
+  uint8_t txBuffer[BUFFER_SIZE];
+  int txLength = 0;
+
+  // Bytes returned by the last requestFrom()
+  uint8_t rxBuffer[BUFFER_SIZE];
+  int rxLength = 0;
+  int rxIndex = 0;
+
+  // Register pointer per transaction (set by the last write)
+  uint8_t registerPointer = 0;
+
+  // Bus statistics
+  unsigned long transactionCount = 0;
+  unsigned long bytesTransferred = 0;
+
+  HostI2CDevice* find(uint8_t address) const {
+    for (int i = 0; i < deviceCount; i++) {
+      if (devices[i].address == address) return devices[i].device;
+    }
+    return nullptr;
+  }
+
+  // Address byte + payload, 9 clocks per byte (8 data + ACK)
+  void chargeTransfer(int payloadBytes) {
+    transactionCount++;
+    bytesTransferred += payloadBytes;
+    if (chargeBusTime && clockHz > 0) {
+      HostClock::advanceMicros(((uint64_t)(payloadBytes + 1) * 9ULL * 1000000ULL) / clockHz);
+    }
+  }
+
+public:
+  bool begin() { return true; }
+  bool begin(int sda, int scl, uint32_t frequency = 0) {
+    (void)sda; (void)scl;
+    if (frequency) clockHz = frequency;
+    return true;
+  }
+  void setClock(uint32_t frequency) { clockHz = frequency; }
+  uint32_t getClock() const { return clockHz; }
+
+  // ----- Host controls -----
+  void attach(uint8_t address, HostI2CDevice* device) {
+    for (int i = 0; i < deviceCount; i++) {
+      if (devices[i].address == address) { devices[i].device = device; return; }
+    }
+    if (deviceCount < MAX_DEVICES) {
+      devices[deviceCount++] = {address, device};
+    }
+  }
+  void detachAll() { deviceCount = 0; }
+  void setChargeBusTime(bool enable) { chargeBusTime = enable; }
+  unsigned long getTransactionCount() const { return transactionCount; }
+  unsigned long getBytesTransferred() const { return bytesTransferred; }
+  void resetStats() { transactionCount = 0; bytesTransferred = 0; }
+
+  // ----- Arduino API -----
+  void beginTransmission(uint8_t address) {
+    txAddress = address;
+    txLength = 0;
+  }
+  void beginTransmission(int address) { beginTransmission((uint8_t)address); }
+
+  size_t write(uint8_t value) {
+    if (txLength >= BUFFER_SIZE) return 0;
+    txBuffer[txLength++] = value;
+    return 1;
+  }
+  size_t write(const uint8_t* data, size_t length) {
+    size_t n = 0;
+    while (n < length && write(data[n])) n++;
+    return n;
+  }
+
+  // 0 = success, 2 = NACK on address (matches the Arduino return codes)
+  uint8_t endTransmission(bool sendStop = true) {
+    (void)sendStop;
+    HostI2CDevice* device = find(txAddress);
+    chargeTransfer(txLength);
+    if (!device) return 2;
+
+    if (txLength > 0) {
+      registerPointer = txBuffer[0];
+      uint8_t reg = registerPointer;
+      for (int i = 1; i < txLength; i++) {
+        device->writeRegister(reg, txBuffer[i]);
+        if (!device->isStreamRegister(reg)) reg++;
+      }
+    }
+    return 0;
+  }
+
+  uint8_t requestFrom(uint8_t address, uint8_t quantity, bool sendStop = true) {
+    (void)sendStop;
+    rxLength = 0;
+    rxIndex = 0;
+
+    HostI2CDevice* device = find(address);
+    if (!device) {
+      chargeTransfer(0);
+      return 0;
+    }
+
+    if (quantity > BUFFER_SIZE) quantity = BUFFER_SIZE;
+    uint8_t reg = registerPointer;
+    for (int i = 0; i < quantity; i++) {
+      rxBuffer[rxLength++] = device->readRegister(reg);
+      if (!device->isStreamRegister(reg)) reg++;
+    }
+    registerPointer = reg;
+    chargeTransfer(quantity);
+    return quantity;
+  }
+  uint8_t requestFrom(int address, int quantity, int sendStop = 1) {
+    return requestFrom((uint8_t)address, (uint8_t)quantity, sendStop != 0);
+  }
+
+  int available() const { return rxLength - rxIndex; }
+  int read() { return rxIndex < rxLength ? rxBuffer[rxIndex++] : -1; }
+};
+
+inline TwoWire Wire;
+
+#endif // HOST_WIRE_H
@@ -0,0 +1,143 @@
+#ifndef IMU_TRACES_H
+#define IMU_TRACES_H
+
+// IMU traces for replay through MPU6050Model's FIFO.
+// A trace is a list of samples at MPUConfig::SAMPLE_RATE_HZ as the sensor
+// would report them (accel in g, gyro in degrees/second, die temperature),
+// each with the true "up" vector it was generated from. The scripted motions
+// below are built from a rigid-body orientation plus hand acceleration, so
+// gyro and accelerometer agree the way they do on the device; the gyro adds a
+// zero-rate offset that drifts linearly with temperature. Recorded dumps can
+// be replayed the same way with MPU6050Model::loadFifoDump().
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include "config/Constants.h"
+
+struct ImuSample {
+  float ax, ay, az;
+  float gx, gy, gz;
+  float temperature;         // Degrees C
+  float upX, upY, upZ;       // Ground truth gravity direction, sensor frame
+};
+
+class ImuTrace {
+private:
+  static constexpr float PI_F = 3.14159265f;
+
+  std::vector<ImuSample> samples;
+  std::mt19937 rng;
+  std::normal_distribution<float> accelNoise;
+  std::normal_distribution<float> gyroNoise;
+
+  // Current attitude: "up" in the sensor frame
+  float upX = 0, upY = 0, upZ = 1;
+
+  // Gyro zero-rate offset at 25 C, its drift per degree, die temperature
+  float offset[3] = {0, 0, 0};
+  float offsetSlope[3] = {0, 0, 0};
+  float temperature = 25;
+  float temperatureRate = 0;       // Degrees C per second
+
+public:
+  static constexpr float DT = 1.0f / MPUConfig::SAMPLE_RATE_HZ;
+
+  // Noise figures close to the MPU-6050 datasheet at the configured DLPF
+  explicit ImuTrace(uint32_t seed = 1) : rng(seed), accelNoise(0.0f, 0.004f), gyroNoise(0.0f, 0.05f) {}
+
+  const std::vector<ImuSample>& getSamples() const { return samples; }
+  size_t size() const { return samples.size(); }
+
+  // Start from "up" tilted toward +X by `tilt` (its X component)
+  void setTilt(float tilt) {
+    upX = tilt;
+    upY = 0;
+    upZ = sqrtf(1.0f - tilt * tilt);
+  }
+
+  void setGyroOffset(float x, float y, float z) {
+    offset[0] = x;
+    offset[1] = y;
+    offset[2] = z;
+  }
+
+  void setGyroOffsetSlope(float x, float y, float z) {
+    offsetSlope[0] = x;
+    offsetSlope[1] = y;
+    offsetSlope[2] = z;
+  }
+
+  void setTemperature(float celsius, float celsiusPerSecond = 0) {
+    temperature = celsius;
+    temperatureRate = celsiusPerSecond;
+  }
+
+  // What the gyro reads on `axis` at rest right now
+  float getGyroOffset(int axis) const {
+    return offset[axis] + offsetSlope[axis] * (temperature - 25.0f);
+  }
+
+  // Rotate at a constant rate (degrees/second) for `seconds`, with extra
+  // hand acceleration hand(t) in g
+  template <typename Hand>
+  void rotate(float gx, float gy, float gz, float seconds, Hand hand) {
+    int count = (int)lroundf(seconds / DT);
+    for (int i = 0; i < count; i++) {
+      // Exact rotation of "up" by -w * dt (Rodrigues), so the truth does not
+      // share the filter's small-angle approximation
+      float rate = sqrtf(gx * gx + gy * gy + gz * gz);
+      if (rate > 0) {
+        float angle = -rate * DT * PI_F / 180.0f;
+        float kx = gx / rate, ky = gy / rate, kz = gz / rate;
+        float c = cosf(angle), s = sinf(angle);
+        float dot = kx * upX + ky * upY + kz * upZ;
+        float x = upX * c + (ky * upZ - kz * upY) * s + kx * dot * (1 - c);
+        float y = upY * c + (kz * upX - kx * upZ) * s + ky * dot * (1 - c);
+        float z = upZ * c + (kx * upY - ky * upX) * s + kz * dot * (1 - c);
+        upX = x;
+        upY = y;
+        upZ = z;
+      }
+
+      float handX = 0, handY = 0, handZ = 0;
+      hand(samples.size() * DT, handX, handY, handZ);
+
+      ImuSample sample;
+      sample.ax = upX + handX + accelNoise(rng);
+      sample.ay = upY + handY + accelNoise(rng);
+      sample.az = upZ + handZ + accelNoise(rng);
+      sample.gx = gx + getGyroOffset(0) + gyroNoise(rng);
+      sample.gy = gy + getGyroOffset(1) + gyroNoise(rng);
+      sample.gz = gz + getGyroOffset(2) + gyroNoise(rng);
+      sample.temperature = temperature;
+      temperature += temperatureRate * DT;
+      sample.upX = upX;
+      sample.upY = upY;
+      sample.upZ = upZ;
+      samples.push_back(sample);
+    }
+  }
+
+  void rotate(float gx, float gy, float gz, float seconds) {
+    rotate(gx, gy, gz, seconds, [](float, float&, float&, float&) {});
+  }
+
+  void hold(float seconds) { rotate(0, 0, 0, seconds); }
+
+  // Held still while the hand shakes back and forth along X
+  void shake(float seconds, float amplitudeG, float hz) {
+    rotate(0, 0, 0, seconds, [=](float t, float& x, float&, float&) {
+      x = amplitudeG * sinf(2 * PI_F * hz * t);
+    });
+  }
+
+  // Held still with a gyro that reads an extra `bias` degrees/second about Y
+  void holdWithBias(float seconds, float bias) {
+    offset[1] += bias;
+    hold(seconds);
+    offset[1] -= bias;
+  }
+};
+
+#endif // IMU_TRACES_H
@@ -0,0 +1,201 @@
+#ifndef MPU6050_MODEL_H
+#define MPU6050_MODEL_H
+
+// Simulated MPU-6050 on the host Wire bus.
+// Holds a register file and encodes physical values into the data registers
+// with the ranges MPUSensor configures (±2g, ±250°/s).
+//
+// FIFO: once enabled through USER_CTRL, a sample of the current data
+// registers is pushed every sample period of virtual time (1 kHz / (1 +
+// SMPLRT_DIV) with the DLPF on), scheduled on the HostClock. With DATA_RDY
+// enabled in INT_ENABLE each sample also triggers the interrupt pin given to
+// connectInterrupt(). Recorded dumps can be replayed with
+// setAutoSample(false) and loadFifoDump().
+
+#include <Wire.h>
+#include <deque>
+#include <vector>
+
+class MPU6050Model : public HostRegisterDevice {
+public:
+  static constexpr uint8_t REG_SMPLRT_DIV = 0x19;
+  static constexpr uint8_t REG_CONFIG = 0x1A;
+  static constexpr uint8_t REG_FIFO_EN = 0x23;
+  static constexpr uint8_t REG_INT_ENABLE = 0x38;
+  static constexpr uint8_t REG_INT_STATUS = 0x3A;
+  static constexpr uint8_t REG_ACCEL_XOUT_H = 0x3B;
+  static constexpr uint8_t REG_TEMP_OUT_H = 0x41;
+  static constexpr uint8_t REG_GYRO_XOUT_H = 0x43;
+  static constexpr uint8_t REG_USER_CTRL = 0x6A;
+  static constexpr uint8_t REG_PWR_MGMT_1 = 0x6B;
+  static constexpr uint8_t REG_FIFO_COUNT_H = 0x72;
+  static constexpr uint8_t REG_FIFO_COUNT_L = 0x73;
+  static constexpr uint8_t REG_FIFO_R_W = 0x74;
+  static constexpr uint8_t REG_WHO_AM_I = 0x75;
+
+  static constexpr uint8_t USER_CTRL_FIFO_EN = 0x40;
+  static constexpr uint8_t USER_CTRL_FIFO_RESET = 0x04;
+  static constexpr uint8_t INT_FIFO_OFLOW = 0x10;
+  static constexpr size_t FIFO_SIZE = 1024;
+
+  static constexpr float ACCEL_LSB_PER_G = 16384.0f;
+  static constexpr float GYRO_LSB_PER_DPS = 131.0f;
+
+  MPU6050Model() {
+    registers[REG_PWR_MGMT_1] = 0x40;  // Sleep bit set at power-on
+    registers[REG_WHO_AM_I] = 0x68;
+    setAccel(0, 0, 1);
+  }
+
+  // Acceleration in g
+  void setAccel(float x, float y, float z) {
+    setRegister16(REG_ACCEL_XOUT_H, toRaw(x * ACCEL_LSB_PER_G));
+    setRegister16(REG_ACCEL_XOUT_H + 2, toRaw(y * ACCEL_LSB_PER_G));
+    setRegister16(REG_ACCEL_XOUT_H + 4, toRaw(z * ACCEL_LSB_PER_G));
+  }
+
+  // Angular rate in degrees/second
+  void setGyro(float x, float y, float z) {
+    setRegister16(REG_GYRO_XOUT_H, toRaw(x * GYRO_LSB_PER_DPS));
+    setRegister16(REG_GYRO_XOUT_H + 2, toRaw(y * GYRO_LSB_PER_DPS));
+    setRegister16(REG_GYRO_XOUT_H + 4, toRaw(z * GYRO_LSB_PER_DPS));
+  }
+
+  // Die temperature in °C (datasheet: raw / 340 + 36.53)
+  void setTemperature(float celsius) {
+    setRegister16(REG_TEMP_OUT_H, toRaw((celsius - 36.53f) * 340.0f));
+  }
+
+  bool isAwake() const { return (registers[REG_PWR_MGMT_1] & 0x40) == 0; }
+
+  // ----- FIFO host controls -----
+  // Off: the FIFO only holds what loadFifoDump() puts there
+  void setAutoSample(bool enabled) {
+    autoSample = enabled;
+    startSampleClock();
+  }
+
+  // INT pin wiring (-1 = not connected)
+  void connectInterrupt(int pin) { interruptPin = pin; }
+
+  // Drop interrupt pulses (e.g. to exercise the untimed-sample path)
+  void setInterruptLoss(bool lose) { loseInterrupts = lose; }
+
+  void loadFifoDump(const std::vector<uint8_t>& dump) {
+    for (uint8_t value : dump) pushFifo(value);
+  }
+
+  void clearFifo() { fifo.clear(); }
+  size_t getFifoCount() const { return fifo.size(); }
+
+  // One FIFO record (accel XYZ + gyro XYZ, big-endian) as MPUSensor configures it
+  static void appendRecord(std::vector<uint8_t>& dump, float ax, float ay, float az,
+                           float gx, float gy, float gz) {
+    const float values[6] = {ax * ACCEL_LSB_PER_G, ay * ACCEL_LSB_PER_G, az * ACCEL_LSB_PER_G,
+                             gx * GYRO_LSB_PER_DPS, gy * GYRO_LSB_PER_DPS, gz * GYRO_LSB_PER_DPS};
+    for (float value : values) {
+      uint16_t raw = (uint16_t)toRaw(value);
+      dump.push_back(raw >> 8);
+      dump.push_back(raw & 0xFF);
+    }
+  }
+
+  // ----- Bus side -----
+  uint8_t readRegister(uint8_t reg) override {
+    switch (reg) {
+      case REG_FIFO_COUNT_H:
+        latchedCount = (uint16_t)fifo.size();
+        return latchedCount >> 8;
+      case REG_FIFO_COUNT_L:
+        return latchedCount & 0xFF;
+      case REG_FIFO_R_W: {
+        if (fifo.empty()) return 0;
+        uint8_t value = fifo.front();
+        fifo.pop_front();
+        return value;
+      }
+      case REG_INT_STATUS: {
+        uint8_t status = registers[REG_INT_STATUS];
+        registers[REG_INT_STATUS] = 0;  // Cleared on read
+        return status;
+      }
+      default:
+        return registers[reg];
+    }
+  }
+
+  void writeRegister(uint8_t reg, uint8_t value) override {
+    if (reg == REG_USER_CTRL) {
+      if (value & USER_CTRL_FIFO_RESET) fifo.clear();
+      bool wasEnabled = fifoEnabled();
+      registers[reg] = value & ~USER_CTRL_FIFO_RESET;
+      if (wasEnabled != fifoEnabled()) startSampleClock();
+      return;
+    }
+    registers[reg] = value;
+  }
+
+  bool isStreamRegister(uint8_t reg) const override { return reg == REG_FIFO_R_W; }
+
+private:
+  std::deque<uint8_t> fifo;
+  uint16_t latchedCount = 0;
+  bool autoSample = true;
+  int interruptPin = -1;
+  bool loseInterrupts = false;
+  uint32_t clockGeneration = 0;  // Invalidates sample events already scheduled
+
+  bool fifoEnabled() const { return (registers[REG_USER_CTRL] & USER_CTRL_FIFO_EN) != 0; }
+
+  uint64_t samplePeriodMicros() const {
+    uint64_t outputRateHz = (registers[REG_CONFIG] & 0x07) ? 1000 : 8000;
+    return 1000000ULL * (1 + registers[REG_SMPLRT_DIV]) / outputRateHz;
+  }
+
+  // Full FIFO overwrites its oldest byte and flags an overflow
+  void pushFifo(uint8_t value) {
+    if (fifo.size() >= FIFO_SIZE) {
+      fifo.pop_front();
+      registers[REG_INT_STATUS] |= INT_FIFO_OFLOW;
+    }
+    fifo.push_back(value);
+  }
+
+  void startSampleClock() {
+    clockGeneration++;
+    if (fifoEnabled() && autoSample) scheduleSample(HostClock::getMicros() + samplePeriodMicros());
+  }
+
+  void scheduleSample(uint64_t at) {
+    uint32_t generation = clockGeneration;
+    HostClock::schedule(at, [this, generation, at]() {
+      if (generation != clockGeneration) return;
+      takeSample();
+      scheduleSample(at + samplePeriodMicros());
+    });
+  }
+
+  // Push the current data registers and pulse INT
+  void takeSample() {
+    uint8_t enabled = registers[REG_FIFO_EN];
+    if (enabled & 0x08) pushRegisters(REG_ACCEL_XOUT_H, 6);
+    if (enabled & 0x80) pushRegisters(REG_TEMP_OUT_H, 2);
+    if (enabled & 0x40) pushRegisters(REG_GYRO_XOUT_H, 2);
+    if (enabled & 0x20) pushRegisters(REG_GYRO_XOUT_H + 2, 2);
+    if (enabled & 0x10) pushRegisters(REG_GYRO_XOUT_H + 4, 2);
+
+    if ((registers[REG_INT_ENABLE] & 0x01) && interruptPin >= 0 && !loseInterrupts) {
+      HostInterrupts::trigger(interruptPin);
+    }
+  }
+
+  void pushRegisters(uint8_t first, int count) {
+    for (int i = 0; i < count; i++) pushFifo(registers[first + i]);
+  }
+
+  static int16_t toRaw(float value) {
+    return (int16_t)constrain(lroundf(value), -32768L, 32767L);
+  }
+};
+
+#endif // MPU6050_MODEL_H
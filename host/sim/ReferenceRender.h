@@ -0,0 +1,96 @@
+#ifndef REFERENCE_RENDER_H
+#define REFERENCE_RENDER_H
+
+// Float render path as it was before the fixed-point pipeline.
+// Used on the host to produce golden frames from an engine's state and to
+// benchmark the old per-pixel cost against the current render().
+
+#include <Arduino.h>
+#include "effects/AnimationEngine.h"
+
+namespace ReferenceRender {
+  inline uint32_t hsvToRgb(float h, float s, float v) {
+    h = constrain(h, 0.0, 1.0);
+    s = constrain(s, 0.0, 1.0);
+    v = constrain(v, 0.0, 1.0);
+
+    float hue = h * 6.0;
+    float c = v * s;
+    float x = c * (1.0 - abs(fmod(hue, 2.0) - 1.0));
+    float m = v - c;
+
+    float r, g, b;
+    if (hue < 1.0)      { r = c; g = x; b = 0; }
+    else if (hue < 2.0) { r = x; g = c; b = 0; }
+    else if (hue < 3.0) { r = 0; g = c; b = x; }
+    else if (hue < 4.0) { r = 0; g = x; b = c; }
+    else if (hue < 5.0) { r = x; g = 0; b = c; }
+    else                { r = c; g = 0; b = x; }
+
+    uint8_t rByte = (r + m) * 255;
+    uint8_t gByte = (g + m) * 255;
+    uint8_t bByte = (b + m) * 255;
+
+    return ((uint32_t)rByte << 16) | ((uint32_t)gByte << 8) | bByte;
+  }
+
+  inline uint32_t adjustColorTemperature(uint32_t color, float temperature) {
+    temperature = constrain(temperature, -1.0, 1.0);
+
+    uint8_t r = (color >> 16) & 0xFF;
+    uint8_t g = (color >> 8) & 0xFF;
+    uint8_t b = color & 0xFF;
+
+    if (temperature > 0) {
+      r = min(255, (int)(r * (1.0 + temperature * 0.3)));
+      b = max(0, (int)(b * (1.0 - temperature * 0.3)));
+    } else {
+      float coolFactor = -temperature;
+      r = max(0, (int)(r * (1.0 - coolFactor * 0.3)));
+      b = min(255, (int)(b * (1.0 + coolFactor * 0.3)));
+    }
+
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+
+  // Render the engine's current state into out[NumLeds]
+  template <int NumLeds>
+  void render(const AnimationEngineT<NumLeds>& engine, PaletteManagerT<NumLeds>& palettes,
+              float tiltAngle, uint32_t* out) {
+    ColorPalette* palette = palettes.getPalette(palettes.getPaletteIndexForTilt(tiltAngle));
+
+    for (int i = 0; i < NumLeds; i++) {
+      uint32_t color;
+      uint32_t customColor = palettes.hasCustomColors() ? palettes.getCustomLEDColor(i) : 0;
+
+      if (customColor != 0) {
+        color = customColor;
+      } else if (palette->colorCount == 0) {
+        color = 0xFFFFFF;
+      } else if (engine.getPattern() == PATTERN_RAINBOW_CYCLE) {
+        float hue = (engine.getGlobalHue() + (i * 360.0 / NumLeds)) / 360.0;
+        hue = fmod(hue, 1.0);
+        color = hsvToRgb(hue, 1.0, 1.0);
+      } else {
+        color = palette->colors[(i * palette->colorCount) / NumLeds];
+      }
+
+      if (engine.isTempoColorReactive()) {
+        color = adjustColorTemperature(color, engine.getTemperatureShift());
+      }
+
+      uint8_t r = (color >> 16) & 0xFF;
+      uint8_t g = (color >> 8) & 0xFF;
+      uint8_t b = color & 0xFF;
+
+      float level = engine.getLevel(i);
+      r = r * level;
+      g = g * level;
+      b = b * level;
+
+      out[i] = ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+  }
+}
+
+#endif // REFERENCE_RENDER_H
@@ -0,0 +1,90 @@
+"""
+Pre-build step: gzip the dashboard for flash.
+
+Extracts the page from src/control/DashboardHTML.h, compresses it
+(deterministically: no timestamp, no file name) and writes
+src/control/DashboardAsset.h with the compressed bytes and a content-hash
+ETag. The header is only rewritten when its contents change, so unchanged
+builds stay incremental.
+
+Runs from platformio.ini (extra_scripts = pre:scripts/embed_dashboard.py)
+or standalone: python3 scripts/embed_dashboard.py
+"""
+
+import gzip
+import hashlib
+import io
+import os
+import re
+
+try:
+    Import("env")  # noqa: F821 (provided by PlatformIO)
+    ROOT = env["PROJECT_DIR"]  # noqa: F821
+except NameError:
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE = os.path.join(ROOT, "src", "control", "DashboardHTML.h")
+TARGET = os.path.join(ROOT, "src", "control", "DashboardAsset.h")
+BYTES_PER_LINE = 16
+
+
+def extract_html(path):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    match = re.search(r'R"rawliteral\((.*)\)rawliteral"', text, re.S)
+    if not match:
+        raise RuntimeError("no rawliteral block in " + path)
+    return match.group(1).encode("utf-8")
+
+
+def compress(data):
+    buffer = io.BytesIO()
+    with gzip.GzipFile(filename="", mode="wb", compresslevel=9, fileobj=buffer, mtime=0) as f:
+        f.write(data)
+    return buffer.getvalue()
+
+
+def render_header(html, packed):
+    etag = hashlib.sha256(html).hexdigest()[:16]
+    lines = []
+    for i in range(0, len(packed), BYTES_PER_LINE):
+        chunk = packed[i:i + BYTES_PER_LINE]
+        lines.append("    " + ", ".join("0x%02x" % b for b in chunk) + ",")
+
+    return "\n".join([
+        "// Generated by scripts/embed_dashboard.py from DashboardHTML.h - do not edit",
+        "#ifndef DASHBOARD_ASSET_H",
+        "#define DASHBOARD_ASSET_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "// Gzip-compressed dashboard page (%d bytes, %d uncompressed)" % (len(packed), len(html)),
+        "namespace DashboardAsset {",
+        "  constexpr size_t GZIP_SIZE = %d;" % len(packed),
+        "  constexpr size_t HTML_SIZE = %d;" % len(html),
+        "  constexpr char ETAG[] = \"\\\"%s\\\"\";   // Content hash of the page" % etag,
+        "",
+        "  const uint8_t GZIP[GZIP_SIZE] PROGMEM = {",
+        *lines,
+        "  };",
+        "}",
+        "",
+        "#endif // DASHBOARD_ASSET_H",
+        "",
+    ])
+
+
+def main():
+    html = extract_html(SOURCE)
+    header = render_header(html, compress(html))
+
+    if os.path.exists(TARGET):
+        with open(TARGET, encoding="utf-8") as f:
+            if f.read() == header:
+                return
+    with open(TARGET, "w", encoding="utf-8", newline="\n") as f:
+        f.write(header)
+    print("embed_dashboard: wrote " + os.path.relpath(TARGET, ROOT))
+
+
+main()
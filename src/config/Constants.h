@@ -6,13 +6,23 @@ namespace HardwareConfig {
   constexpr int LED_PIN = 10;           // D10 on Xiao ESP32-C3
   constexpr int BATTERY_PIN = A0;        // A0 for battery voltage
   constexpr int NUM_LEDS = 7;            // Total LED count
+  constexpr int MPU_INT_PIN = 3;         // D1 on Xiao ESP32-C3 (MPU-6050 INT, data ready)
 }
 
 // MPU-6050 Sensor Configuration
 namespace MPUConfig {
   constexpr byte MPU_ADDRESS = 0x68;     // I2C address
+  constexpr uint32_t I2C_CLOCK_HZ = 400000; // Fast-mode I2C (MPU-6050 max)
   constexpr int INIT_DELAY_MS = 100;     // Initialization delay
-  constexpr int READ_INTERVAL_MS = 10;   // How often to read sensor
+  constexpr int READ_INTERVAL_MS = 20;   // How often to drain the sensor FIFO
+  constexpr int SAMPLE_RATE_HZ = 100;    // FIFO sample rate (orientation filter step)
+  constexpr byte DLPF_CONFIG = 1;        // Digital low-pass: 188 Hz bandwidth, 1 kHz gyro output
+  constexpr int FIFO_BURST_SAMPLES = 10; // Samples per I2C burst (120 bytes, fits the Wire buffer)
+  constexpr int FIFO_MAX_SAMPLES_PER_READ = 40;  // Cap per drain so one read() stays short
+  constexpr int FIFO_DRAIN_SAMPLES = 2;  // Drain once this many data-ready interrupts are queued
+  constexpr int TIMESTAMP_QUEUE_SIZE = 128; // ISR timestamp ring (power of two, > FIFO's 85 samples)
+  constexpr unsigned long MAX_SAMPLE_GAP_US = 50000; // Longer timestamp gaps (lost samples) step one nominal period
+  constexpr unsigned long TEMPERATURE_INTERVAL_MS = 1000; // Die temperature read (gyro offset model)
 }
 
 // Motion Detection Thresholds
@@ -32,8 +42,49 @@ namespace RotationConfig {
   constexpr float RESET_DEGREES = 90.0f;         // Degrees below which rotation resets
   constexpr unsigned long ROTATION_TIMEOUT_MS = 1000;   // Time before checking reset
   constexpr unsigned long FULL_RESET_MS = 5000;         // Time before full rotation reset
-  constexpr float GYRO_THRESHOLD = 50.0f;        // Minimum gyro value to count as rotating (was 1.0 - WAY too sensitive!)
-  constexpr float GYRO_SCALE_FACTOR = 0.01f;     // Gyro to degrees conversion
+  constexpr float GYRO_THRESHOLD = 15.0f;        // Minimum rate (dps) to count as rotating; 50 before the gyro offset was calibrated
+}
+
+// Orientation Filter (gyro + accelerometer)
+namespace OrientationConfig {
+  constexpr float ACCEL_TIME_CONSTANT_S = 0.5f;  // Gyro trusted below this horizon, gravity above
+  constexpr float ACCEL_REJECT_G = 0.5f;         // Readings this far from 1 g (taps, drops) are not gravity
+}
+
+// Gyro Calibration (zero-rate offset, learned at rest)
+namespace CalibrationConfig {
+  constexpr int BLOCK_SAMPLES = 50;              // Samples per stillness test (0.5 s)
+  constexpr float STILL_RANGE_DPS = 1.5f;        // Max gyro swing within a still block
+  constexpr float STILL_ACCEL_RANGE_G = 0.03f;   // Max |a| swing within a still block
+  constexpr int STARTUP_BLOCKS = 4;              // Still blocks in a row for the startup calibration (2 s)
+  constexpr float MAX_OFFSET_DPS = 25.0f;        // MPU-6050 zero-rate tolerance is +-20 dps
+  constexpr float MAX_TRACKING_STEP_DPS = 2.0f;  // Still blocks further off are steady turns, not drift
+  constexpr float TRACKING_TIME_CONSTANT_S = 30.0f;  // Online offset tracking
+  constexpr bool TEMPERATURE_MODEL = true;       // Fit offset vs die temperature
+  constexpr float TEMPERATURE_MEMORY_BLOCKS = 2000.0f;  // Fit forgets still blocks older than ~this
+  constexpr float MIN_TEMPERATURE_SPREAD_C = 1.5f;      // Fit slope applied once its points spread this much
+  constexpr float MAX_SLOPE_DPS_PER_C = 0.2f;    // Plausible offset drift per degree
+  constexpr unsigned long SAVE_INTERVAL_MS = 600000;    // Flash writes at most every 10 min...
+  constexpr float SAVE_CHANGE_DPS = 0.05f;       // ...and only when the offset moved this much
+  constexpr const char* PREFERENCES_NAMESPACE = "gyrocal";
+}
+
+// Custom gestures (recorded 6-axis templates, DTW matching)
+namespace GestureConfig {
+  constexpr int FRAME_RATE_HZ = 25;              // Samples are averaged into frames at this rate for matching
+  constexpr int MAX_TEMPLATES = 8;
+  constexpr int MAX_TEMPLATE_FRAMES = 32;        // Longest gesture (1.28 s)
+  constexpr int MIN_TEMPLATE_FRAMES = 5;         // Shortest gesture (0.2 s)
+  constexpr int NAME_LENGTH = 12;                // Including the terminator
+  constexpr float ACCEL_SCALE = 1000.0f;         // Feature units per g of linear acceleration
+  constexpr float GYRO_SCALE = 4.0f;             // Feature units per dps (250 dps weighs like 1 g)
+  constexpr int32_t ACTIVE_FRAME = 300;          // Frame L1 norm that counts as moving while recording
+  constexpr int QUIET_FRAMES_TO_STOP = 5;        // Quiet frames that end a recording (0.2 s)
+  constexpr int RECORD_WAIT_FRAMES = 125;        // Give up if the gesture has not started after 5 s
+  constexpr int32_t MATCH_RATIO_Q8 = 112;        // Match: DTW cost <= 112/256 of the template's cost against stillness
+  constexpr int SETTLE_FRAMES = 3;               // Best candidate must hold this many frames before firing
+  constexpr int COMMAND_QUEUE_SLOTS = 4;         // Bound commands waiting for the render task (power of two)
+  constexpr const char* PREFERENCES_NAMESPACE = "gestures";
 }
 
 // Tempo Detection & BPM
@@ -55,6 +106,11 @@ namespace EffectsConfig {
   constexpr unsigned long STROBE_INTERVAL_MS = 20;       // Strobe flash interval
   constexpr unsigned long ANIMATION_INTERVAL_MS = 50;    // Animation update rate (20 FPS)
   constexpr unsigned long IDLE_SPARKLE_INTERVAL_MS = 3000; // Idle mode sparkle frequency
+  constexpr int REFERENCE_LED_COUNT = 7;                 // Strip length the effect sizes above were tuned on
+  constexpr int TARGET_FPS = 50;                         // Render/latch rate of the LED strip
+  constexpr unsigned long FRAME_INTERVAL_US = 1000000UL / TARGET_FPS;  // Frame period (also the per-frame budget)
+  constexpr float OUTPUT_GAMMA = 1.0f;                   // LED output gamma (1.0 = linear; effect levels are tuned by eye)
+  constexpr int DITHER_STEADY_FRAMES = TARGET_FPS;       // A frame held this long stops dithering (nearest 8-bit value)
 }
 
 // Battery Monitoring
@@ -72,14 +128,42 @@ namespace WiFiConfig {
   constexpr char SSID[] = "Ctenophore-Control";
   constexpr char PASSWORD[] = "tempo123";
   constexpr int SERVER_PORT = 80;
-  constexpr unsigned long STATUS_UPDATE_INTERVAL_MS = 100; // Web dashboard polling rate
+  constexpr unsigned long STATUS_UPDATE_INTERVAL_MS = 100; // Dashboard push tick (sent only when something changed)
+  constexpr unsigned long STATUS_FULL_INTERVAL_MS = 5000;  // Full snapshot so clients that missed a delta resync
+  constexpr unsigned long EVENTS_RECONNECT_MS = 2000;      // Browser retry delay after the /events stream drops
+  constexpr int MAX_BATCH_COMMANDS = 16;         // Commands per POST /command
+  constexpr int COMMAND_QUEUE_SLOTS = 32;        // Web commands waiting for the next frame (power of two)
+  constexpr size_t COMMAND_BODY_MAX_BYTES = 1024;    // Largest POST /command body
+  constexpr unsigned long COMMAND_BODY_TIMEOUT_MS = 2000; // Unfinished body gives way to a new request
+  constexpr size_t METRICS_MAX_BYTES = 3072;     // GET /metrics response
+  constexpr size_t STATUS_MAX_BYTES = 2048;      // Largest status JSON (stack buffer on the network and async TCP tasks)
 }
 
 // System Timing & Behavior
 namespace SystemConfig {
   constexpr unsigned long IDLE_TIMEOUT_MS = 300000;  // Auto-return to liquid after 5 min inactivity
   constexpr unsigned long SERIAL_BAUD_RATE = 115200;
-  constexpr unsigned long DEBUG_PRINT_INTERVAL_MS = 5000; // Debug output frequency
+  constexpr unsigned long DEBUG_PRINT_INTERVAL_MS = 5000; // Debug output frequency (`stats=on`)
+  constexpr bool STAGE_TIMING = true;                // Stage timers for `stats` and /metrics (false compiles them out)
+  constexpr int COMMAND_MAX_LENGTH = 64;             // Longest command (serial line or queued web command)
+  constexpr int SERIAL_QUEUE_SLOTS = 8;              // Serial commands waiting for the next frame (power of two)
+  constexpr int COMMANDS_PER_FRAME = 16;             // Queued commands applied per frame (whole batches)
+  constexpr unsigned long SERIAL_COMMAND_IDLE_MS = 100;  // Input pause that ends a line without newline
+}
+
+// FreeRTOS task layout (ESP32-C3: one core, so priority decides who runs)
+namespace TaskConfig {
+  constexpr int CORE = 0;
+  constexpr int SENSOR_PRIORITY = 5;             // Above AsyncTCP (3): a slow HTTP response never delays sampling
+  constexpr int RENDER_PRIORITY = 4;             // Fixed-FPS frames, also above AsyncTCP
+  constexpr int NETWORK_PRIORITY = 1;            // Serial input and dashboard push
+  constexpr uint32_t SENSOR_STACK_BYTES = 4096;
+  constexpr uint32_t RENDER_STACK_BYTES = 6144;
+  constexpr uint32_t NETWORK_STACK_BYTES = 6144;
+  constexpr unsigned long SENSOR_POLL_MS = 5;    // How often the sensor task checks for queued samples
+  constexpr unsigned long NETWORK_INTERVAL_MS = 10;
+  constexpr int GESTURE_QUEUE_LENGTH = 8;        // Gestures waiting for the render task
+  constexpr int SENSOR_REQUEST_SLOTS = 4;        // Commands waiting for the sensor task (power of two)
 }
 
 // Color Palette Configuration
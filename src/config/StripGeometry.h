@@ -0,0 +1,29 @@
+#ifndef STRIP_GEOMETRY_H
+#define STRIP_GEOMETRY_H
+
+#include "Constants.h"
+
+// Compile-time description of an LED strip of NumLeds pixels
+// Effect sizes in EffectsConfig are tuned for REFERENCE_LED_COUNT pixels;
+// this scales them so the same effect covers the same fraction of any strip.
+template <int NumLeds>
+struct StripGeometry {
+  static_assert(NumLeds > 0, "Strip needs at least one LED");
+
+  static constexpr int COUNT = NumLeds;
+  static constexpr int CENTER = NumLeds / 2;
+  static constexpr int LAST = NumLeds - 1;
+
+  // Pixels per reference pixel (1.0 on the 7-LED strip)
+  static constexpr float SCALE = (float)NumLeds / EffectsConfig::REFERENCE_LED_COUNT;
+
+  // Liquid blob half-width when tilted, and when resting centered
+  static constexpr float LIQUID_SPREAD = 1.5f * SCALE;
+  static constexpr float LIQUID_CENTER_SPREAD = 0.5f * SCALE;
+
+  // Ripple wave (tap feedback)
+  static constexpr float TRAIL_LENGTH = EffectsConfig::TRAIL_LENGTH * SCALE;
+  static constexpr float WAVE_SPEED = EffectsConfig::WAVE_SPEED * SCALE;
+};
+
+#endif // STRIP_GEOMETRY_H
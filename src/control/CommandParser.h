@@ -3,107 +3,337 @@
 
 #include <Arduino.h>
 #include <functional>
-#include <ArduinoJson.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../config/Constants.h"
+
+// Non-owning view of command text (not NUL-terminated, never copied to the heap)
+struct CommandText {
+  const char* data;
+  size_t length;
+
+  CommandText() : data(""), length(0) {}
+  CommandText(const char* text, size_t len) : data(text), length(len) {}
+  CommandText(const char* text) : data(text), length(strlen(text)) {}
+
+  bool isEmpty() const { return length == 0; }
+
+  bool equals(const char* literal) const {
+    return strlen(literal) == length && memcmp(data, literal, length) == 0;
+  }
+  bool operator==(const char* literal) const { return equals(literal); }
+  bool operator!=(const char* literal) const { return !equals(literal); }
+
+  bool equalsIgnoreCase(const char* literal) const {
+    if (strlen(literal) != length) return false;
+    for (size_t i = 0; i < length; i++) {
+      if (tolower((unsigned char)data[i]) != tolower((unsigned char)literal[i])) return false;
+    }
+    return true;
+  }
+
+  // Without leading/trailing whitespace
+  CommandText trimmed() const {
+    size_t start = 0;
+    size_t end = length;
+    while (start < end && isspace((unsigned char)data[start])) start++;
+    while (end > start && isspace((unsigned char)data[end - 1])) end--;
+    return CommandText(data + start, end - start);
+  }
+
+  // Offset of `c`, or -1
+  int indexOf(char c) const {
+    const void* found = memchr(data, c, length);
+    return found ? (int)((const char*)found - data) : -1;
+  }
+
+  CommandText substring(size_t from, size_t to) const {
+    if (to > length) to = length;
+    if (from > to) from = to;
+    return CommandText(data + from, to - from);
+  }
+
+  // Whole-text number conversion (false on empty text or trailing garbage)
+  bool toFloat(float& result) const {
+    char buffer[24];
+    if (!terminate(buffer, sizeof(buffer))) return false;
+    char* end;
+    result = strtof(buffer, &end);
+    return end != buffer && *end == '\0';
+  }
+
+  bool toInt(long& result, int base = 10) const {
+    char buffer[24];
+    if (!terminate(buffer, sizeof(buffer))) return false;
+    char* end;
+    result = strtol(buffer, &end, base);
+    return end != buffer && *end == '\0';
+  }
+
+  size_t print() const {
+    return Serial.write((const uint8_t*)data, length);
+  }
+
+private:
+  // NUL-terminated copy for the C conversion functions
+  bool terminate(char* buffer, size_t size) const {
+    if (length == 0 || length >= size) return false;
+    memcpy(buffer, data, length);
+    buffer[length] = '\0';
+    return true;
+  }
+};
 
 // Command structure
 struct Command {
   const char* name;
-  std::function<void(String)> handler;
+  std::function<void(const CommandText&)> handler;
 };
 
+// Receives complete serial lines instead of parse() (e.g. to queue them)
+typedef void (*SerialLineHandler)(const CommandText& line);
+
 // Unified command parser for serial and web inputs
+// Input is parsed in place as "name" or "name=value" (whitespace trimmed)
+// and dispatched by exact name through an open-addressed hash table of the
+// registered commands, built once at registration in fixed storage. Nothing
+// on the parse path allocates.
 class CommandParser {
+public:
+  static constexpr int MAX_COMMANDS = 32;
+  static constexpr int TABLE_SIZE = 64;          // Power of two, >= 2x MAX_COMMANDS
+
+  // FNV-1a; constexpr so command names can be hashed at compile time
+  static constexpr uint32_t hashName(const char* name, uint32_t hash = 2166136261u) {
+    return *name ? hashName(name + 1, (hash ^ (uint8_t)*name) * 16777619u) : hash;
+  }
+
+  static uint32_t hashText(const CommandText& text) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < text.length; i++) {
+      hash = (hash ^ (uint8_t)text.data[i]) * 16777619u;
+    }
+    return hash;
+  }
+
 private:
+  static constexpr int8_t EMPTY_SLOT = -1;
+
   Command* commands;
   int commandCount;
 
+  // Dispatch table: command index per slot, with its name hash
+  int8_t slots[TABLE_SIZE];
+  uint32_t slotHashes[TABLE_SIZE];
+  int longestProbe;
+
+  // Serial line assembly
+  char serialLine[SystemConfig::COMMAND_MAX_LENGTH];
+  size_t serialLength;
+  bool serialOverflow;
+  unsigned long lastSerialByte;
+  SerialLineHandler serialLineHandler;
+
+  void flushSerialLine() {
+    if (serialOverflow) {
+      Serial.println("❌ Command too long");
+    } else if (serialLength > 0 && serialLineHandler) {
+      serialLineHandler(CommandText(serialLine, serialLength));
+    } else if (serialLength > 0) {
+      parse(serialLine, serialLength);
+    }
+    serialLength = 0;
+    serialOverflow = false;
+  }
+
 public:
-  CommandParser() : commands(nullptr), commandCount(0) {}
+  CommandParser()
+    : commands(nullptr),
+      commandCount(0),
+      longestProbe(0),
+      serialLength(0),
+      serialOverflow(false),
+      lastSerialByte(0),
+      serialLineHandler(nullptr) {
+    memset(slots, EMPTY_SLOT, sizeof(slots));
+  }
 
-  // Register commands
+  // Register commands (the array must outlive the parser)
   void registerCommands(Command* cmdArray, int count) {
+    if (count > MAX_COMMANDS) {
+      Serial.println("⚠️ Too many commands - extra entries ignored");
+      count = MAX_COMMANDS;
+    }
     commands = cmdArray;
     commandCount = count;
+    longestProbe = 0;
+    memset(slots, EMPTY_SLOT, sizeof(slots));
+
+    for (int i = 0; i < count; i++) {
+      uint32_t hash = hashName(cmdArray[i].name);
+      if (find(CommandText(cmdArray[i].name), hash) >= 0) {
+        Serial.print("⚠️ Duplicate command ignored: ");
+        Serial.println(cmdArray[i].name);
+        continue;
+      }
+
+      int probe = 0;
+      int slot = hash & (TABLE_SIZE - 1);
+      while (slots[slot] != EMPTY_SLOT) {
+        slot = (slot + 1) & (TABLE_SIZE - 1);
+        probe++;
+      }
+      slots[slot] = (int8_t)i;
+      slotHashes[slot] = hash;
+      if (probe > longestProbe) longestProbe = probe;
+    }
   }
 
-  // Parse and execute command
-  bool parse(String input) {
-    input.trim();
+  // Index of the command called `name`, or -1
+  int find(const CommandText& name, uint32_t hash) const {
+    int slot = hash & (TABLE_SIZE - 1);
+    for (int probe = 0; probe <= longestProbe; probe++) {
+      int index = slots[slot];
+      if (index == EMPTY_SLOT) return -1;
+      if (slotHashes[slot] == hash && name.equals(commands[index].name)) return index;
+      slot = (slot + 1) & (TABLE_SIZE - 1);
+    }
+    return -1;
+  }
 
-    // Handle key=value format
-    int equalsIndex = input.indexOf('=');
-    String cmdName, cmdValue;
+  int find(const CommandText& name) const {
+    return find(name, hashText(name));
+  }
+
+  // Slots past the home slot the worst lookup inspects (0 = perfect hash)
+  int getLongestProbe() const { return longestProbe; }
 
+  // Split "name" / "name=value" (trimmed); false for blank input
+  static bool split(const CommandText& input, CommandText& name, CommandText& value) {
+    CommandText text = input.trimmed();
+    name = text;
+    value = CommandText();
+
+    // Handle key=value format
+    int equalsIndex = text.indexOf('=');
     if (equalsIndex > 0) {
-      cmdName = input.substring(0, equalsIndex);
-      cmdValue = input.substring(equalsIndex + 1);
-    } else {
-      cmdName = input;
-      cmdValue = "";
+      name = text.substring(0, equalsIndex).trimmed();
+      value = text.substring(equalsIndex + 1, text.length).trimmed();
     }
+    return !text.isEmpty();
+  }
 
-    // Find and execute command
-    for (int i = 0; i < commandCount; i++) {
-      if (cmdName == commands[i].name || input.startsWith(commands[i].name)) {
-        if (commands[i].handler) {
-          commands[i].handler(cmdValue);
-          return true;
-        }
-      }
+  // Would parse() dispatch `input`? Read-only, so other tasks may ask once
+  // the commands are registered
+  bool isKnown(const CommandText& input) const {
+    CommandText name, value;
+    if (!split(input, name, value)) return false;
+    int index = find(name);
+    return index >= 0 && commands[index].handler;
+  }
+
+  // Parse and execute command
+  bool parse(const char* input, size_t length) {
+    CommandText name, value;
+    if (!split(CommandText(input, length), name, value)) return false;
+
+    int index = find(name);
+    if (index >= 0 && commands[index].handler) {
+      commands[index].handler(value);
+      return true;
     }
 
-    Serial.println("❌ Unknown command: " + cmdName);
+    Serial.print("❌ Unknown command: ");
+    name.print();
+    Serial.println();
     return false;
   }
 
-  // Process serial input
+  bool parse(const char* input) {
+    return parse(input, strlen(input));
+  }
+
+  bool parse(const String& input) {
+    return parse(input.c_str(), input.length());
+  }
+
+  // Hand complete serial lines to `handler` (nullptr: parse them directly)
+  void setSerialLineHandler(SerialLineHandler handler) {
+    serialLineHandler = handler;
+  }
+
+  // Process serial input: one command per line. Monitors sending no line
+  // ending are covered by treating a pause in the input as the end of a line.
   void processSerial() {
-    if (Serial.available()) {
-      String command = Serial.readString();
-      parse(command);
+    while (Serial.available()) {
+      int c = Serial.read();
+      if (c < 0) break;
+      lastSerialByte = millis();
+
+      if (c == '\n' || c == '\r') {
+        flushSerialLine();
+      } else if (serialLength < sizeof(serialLine)) {
+        serialLine[serialLength++] = (char)c;
+      } else {
+        serialOverflow = true;
+      }
+    }
+
+    if ((serialLength > 0 || serialOverflow) &&
+        millis() - lastSerialByte >= SystemConfig::SERIAL_COMMAND_IDLE_MS) {
+      flushSerialLine();
     }
   }
 
   // Helper: Parse float with validation
-  static bool parseFloat(String value, float& result, float min, float max) {
-    result = value.toFloat();
-    if (result >= min && result <= max) {
+  static bool parseFloat(const CommandText& value, float& result, float min, float max) {
+    if (value.toFloat(result) && result >= min && result <= max) {
       return true;
     }
-    Serial.println("❌ Invalid value. Range: " + String(min) + " - " + String(max));
+    printRangeError(min, max);
     return false;
   }
 
   // Helper: Parse int with validation
-  static bool parseInt(String value, int& result, int min, int max) {
-    result = value.toInt();
-    if (result >= min && result <= max) {
+  static bool parseInt(const CommandText& value, int& result, int min, int max) {
+    long parsed;
+    if (value.toInt(parsed) && parsed >= min && parsed <= max) {
+      result = (int)parsed;
       return true;
     }
-    Serial.println("❌ Invalid value. Range: " + String(min) + " - " + String(max));
+    printRangeError(min, max);
     return false;
   }
 
   // Helper: Parse boolean
-  static bool parseBool(String value) {
-    value.toLowerCase();
-    return (value == "true" || value == "1" || value == "on");
+  static bool parseBool(const CommandText& value) {
+    return value.equalsIgnoreCase("true") || value == "1" || value.equalsIgnoreCase("on");
   }
 
   // Helper: Parse hex color
-  static uint32_t parseHexColor(String hex) {
-    hex.trim();
-    if (hex.startsWith("#")) {
-      hex = hex.substring(1);
+  static uint32_t parseHexColor(const CommandText& hex) {
+    CommandText digits = hex.trimmed();
+    if (digits.length > 0 && digits.data[0] == '#') {
+      digits = digits.substring(1, digits.length);
     }
 
-    long number = strtol(hex.c_str(), NULL, 16);
+    long number = 0;
+    digits.toInt(number, 16);
     uint8_t r = (number >> 16) & 0xFF;
     uint8_t g = (number >> 8) & 0xFF;
     uint8_t b = number & 0xFF;
 
     return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
   }
+
+private:
+  static void printRangeError(float min, float max) {
+    Serial.print("❌ Invalid value. Range: ");
+    Serial.print(min);
+    Serial.print(" - ");
+    Serial.println(max);
+  }
 };
 
 #endif // COMMAND_PARSER_H
@@ -0,0 +1,110 @@
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "../config/Constants.h"
+#include "CommandParser.h"
+
+// Commands waiting to be applied by another task
+// Single-producer/single-consumer ring of fixed command slots, lock-free in
+// the same way as IsrRingBuffer: a batch is written into free slots and
+// published with one release store of `head`, so the consumer sees all of it
+// or none of it. The consumer (the render task at the start of a frame, or
+// the sensor task between drains) parses straight out of the slots and never
+// splits a batch.
+template <int Slots>
+class CommandQueue {
+  static_assert(Slots >= 2 && (Slots & (Slots - 1)) == 0,
+                "CommandQueue slot count must be a power of two");
+
+private:
+  static constexpr uint32_t MASK = Slots - 1;
+
+  struct Slot {
+    char text[SystemConfig::COMMAND_MAX_LENGTH];
+    uint8_t length;
+    bool batchEnd;                   // Last command of its batch
+  };
+
+  Slot slots[Slots];
+  std::atomic<uint32_t> head;        // Next slot to write (producer)
+  std::atomic<uint32_t> tail;        // Next slot to read (consumer)
+
+  // Statistics
+  std::atomic<uint32_t> batchesRejected;   // Producer side
+  unsigned long commandsApplied;           // Consumer side
+
+public:
+  CommandQueue() : head(0), tail(0), batchesRejected(0), commandsApplied(0) {}
+
+  // Producer side: queue all of `commands` or none of them (queue full, or
+  // a command longer than COMMAND_MAX_LENGTH)
+  bool pushBatch(const CommandText* commands, int count) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    uint32_t free = capacity() - ((h - tail.load(std::memory_order_acquire)) & MASK);
+    bool fits = count > 0 && (uint32_t)count <= free;
+    for (int i = 0; fits && i < count; i++) {
+      fits = commands[i].length <= SystemConfig::COMMAND_MAX_LENGTH;
+    }
+    if (!fits) {
+      batchesRejected.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    for (int i = 0; i < count; i++) {
+      Slot& slot = slots[(h + i) & MASK];
+      memcpy(slot.text, commands[i].data, commands[i].length);
+      slot.length = (uint8_t)commands[i].length;
+      slot.batchEnd = i == count - 1;
+    }
+    head.store((h + count) & MASK, std::memory_order_release);
+    return true;
+  }
+
+  bool push(const CommandText& command) {
+    return pushBatch(&command, 1);
+  }
+
+  // Consumer side: apply whole batches, oldest first, until the next one
+  // would take the frame past `budget` commands. `appliedThisFrame` counts
+  // what other queues already applied in the frame, so several queues share
+  // one budget; the first batch of the frame still goes through alone when
+  // it is larger than the budget. Returns the number applied here.
+  int apply(CommandParser& parser, int budget, int appliedThisFrame = 0) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t h = head.load(std::memory_order_acquire);
+    int applied = 0;
+
+    while (t != h) {
+      int batchLength = 1;
+      while (!slots[(t + batchLength - 1) & MASK].batchEnd) batchLength++;
+      int frameTotal = appliedThisFrame + applied;
+      if (frameTotal > 0 && frameTotal + batchLength > budget) break;
+
+      for (int i = 0; i < batchLength; i++) {
+        const Slot& slot = slots[(t + i) & MASK];
+        parser.parse(slot.text, slot.length);
+      }
+      t = (t + batchLength) & MASK;
+      tail.store(t, std::memory_order_release);
+      applied += batchLength;
+    }
+
+    commandsApplied += applied;
+    return applied;
+  }
+
+  // Commands waiting for the consumer
+  int available() const {
+    uint32_t h = head.load(std::memory_order_acquire);
+    uint32_t t = tail.load(std::memory_order_acquire);
+    return (int)((h - t) & MASK);
+  }
+
+  static constexpr int capacity() { return Slots - 1; }
+  unsigned long getBatchesRejected() const { return batchesRejected.load(std::memory_order_relaxed); }
+  unsigned long getCommandsApplied() const { return commandsApplied; }
+};
+
+#endif // COMMAND_QUEUE_H
@@ -0,0 +1,551 @@
+// Generated by scripts/embed_dashboard.py from DashboardHTML.h - do not edit
+#ifndef DASHBOARD_ASSET_H
+#define DASHBOARD_ASSET_H
+
+#include <Arduino.h>
+
+// Gzip-compressed dashboard page (8538 bytes, 43475 uncompressed)
+namespace DashboardAsset {
+  constexpr size_t GZIP_SIZE = 8538;
+  constexpr size_t HTML_SIZE = 43475;
+  constexpr char ETAG[] = "\"ee1688d9d46e5268\"";   // Content hash of the page
+
+  const uint8_t GZIP[GZIP_SIZE] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xed, 0x3d, 0xed, 0x8e, 0xdb, 0x48,
+    0x72, 0xff, 0xfd, 0x14, 0x6d, 0xed, 0xed, 0x4a, 0x5a, 0x4b, 0x32, 0x25, 0xcd, 0x97, 0x67, 0xac,
+    0xd9, 0x78, 0x66, 0x3c, 0xb7, 0x3e, 0x78, 0x76, 0x8d, 0x1d, 0xef, 0x65, 0xbd, 0x86, 0x71, 0xa6,
+    0xa4, 0xd6, 0x88, 0x67, 0x8a, 0xd4, 0x91, 0xd4, 0x7c, 0xac, 0x6f, 0x80, 0x03, 0x82, 0x00, 0xf9,
+    0x11, 0x24, 0xc0, 0x21, 0x3f, 0x82, 0x20, 0x40, 0x90, 0x5f, 0xc9, 0x0b, 0xe4, 0x85, 0xee, 0x09,
+    0xf2, 0x08, 0xa9, 0xaa, 0x6e, 0x7e, 0x35, 0xbb, 0x49, 0x6a, 0x46, 0x36, 0x10, 0x24, 0x63, 0xd8,
+    0xe6, 0x90, 0xdd, 0xd5, 0x55, 0xd5, 0xd5, 0xf5, 0xd5, 0xc5, 0xe6, 0x83, 0xa7, 0x0f, 0x4f, 0xbe,
+    0x3f, 0x7e, 0xfd, 0xe6, 0xd5, 0x73, 0x36, 0x8f, 0x16, 0xee, 0xe1, 0x83, 0xa7, 0xf8, 0x1f, 0x73,
+    0x6d, 0xef, 0x62, 0xd4, 0xe0, 0x5e, 0x03, 0x6f, 0x70, 0x7b, 0x7a, 0xf8, 0x80, 0xc1, 0xcf, 0xd3,
+    0x05, 0x8f, 0x6c, 0x36, 0x99, 0xdb, 0x41, 0xc8, 0xa3, 0x51, 0xe3, 0xc7, 0xd7, 0xa7, 0xdd, 0xbd,
+    0x46, 0xf6, 0x91, 0x67, 0x2f, 0xf8, 0xa8, 0x71, 0xe9, 0xf0, 0xab, 0xa5, 0x1f, 0x44, 0x0d, 0x36,
+    0xf1, 0xbd, 0x88, 0x7b, 0xd0, 0xf4, 0xca, 0x99, 0x46, 0xf3, 0xd1, 0x94, 0x5f, 0x3a, 0x13, 0xde,
+    0xa5, 0x5f, 0x3a, 0xcc, 0xf1, 0x9c, 0xc8, 0xb1, 0xdd, 0x6e, 0x38, 0xb1, 0x5d, 0x3e, 0xea, 0xf7,
+    0xac, 0x18, 0x54, 0xe4, 0x44, 0x2e, 0x3f, 0x3c, 0x8e, 0xf8, 0x62, 0xe9, 0xb3, 0xcb, 0x41, 0xcf,
+    0x7a, 0xfa, 0x58, 0xdc, 0x12, 0x8f, 0xc3, 0xe8, 0x26, 0xbe, 0xc6, 0x9f, 0xaf, 0xd9, 0xc7, 0xe4,
+    0x1a, 0x7f, 0x16, 0x76, 0x70, 0xe1, 0x78, 0xfb, 0xcc, 0x3a, 0xc8, 0xdd, 0x5e, 0xda, 0xd3, 0xa9,
+    0xe3, 0x5d, 0x14, 0xee, 0x8f, 0xfd, 0xeb, 0x6e, 0xe8, 0xfc, 0x42, 0x8f, 0xc6, 0x7e, 0x30, 0xe5,
+    0x41, 0x17, 0x6e, 0xe5, 0xdb, 0x74, 0xaf, 0xf8, 0xf8, 0x83, 0x13, 0x75, 0x23, 0x7b, 0xd9, 0x9d,
+    0x3b, 0x17, 0x73, 0x17, 0xfe, 0x46, 0xdd, 0x89, 0xef, 0xfa, 0xc1, 0x3e, 0x8b, 0x02, 0xdb, 0x0b,
+    0x97, 0x76, 0x00, 0x74, 0xa6, 0xbd, 0x6e, 0x1f, 0x3c, 0x48, 0x07, 0x98, 0xde, 0x28, 0x28, 0xce,
+    0x80, 0x2d, 0xdd, 0x99, 0xbd, 0x70, 0xdc, 0x9b, 0x7d, 0xd6, 0x3c, 0x5f, 0xda, 0x13, 0xce, 0xce,
+    0x7c, 0xcf, 0x6f, 0x76, 0xd8, 0xca, 0xe9, 0x2e, 0xe0, 0x2a, 0xc4, 0x7b, 0x1d, 0x76, 0x7e, 0x8a,
+    0xb7, 0xbb, 0x3f, 0xf0, 0x8b, 0x95, 0x6b, 0x07, 0x1d, 0x76, 0xc6, 0x3d, 0xd7, 0xef, 0xb0, 0x63,
+    0xdf, 0x0b, 0x7d, 0xd7, 0x0e, 0x3b, 0x2c, 0x69, 0xab, 0x10, 0x65, 0x4f, 0x3e, 0x5c, 0x04, 0xfe,
+    0xca, 0x9b, 0xee, 0xb3, 0x2f, 0x66, 0xdb, 0xf8, 0x27, 0xdf, 0x40, 0xe2, 0xfe, 0xc5, 0x70, 0x38,
+    0xcc, 0x3f, 0x58, 0x38, 0x5e, 0x77, 0xce, 0x91, 0xbe, 0x7d, 0xd6, 0xb7, 0xac, 0xcb, 0x79, 0xfe,
+    0xf1, 0xd4, 0x09, 0x97, 0xae, 0x0d, 0x58, 0xcf, 0x5c, 0xae, 0x30, 0xe9, 0xf7, 0xab, 0x30, 0x72,
+    0x66, 0x37, 0x5d, 0x39, 0xe7, 0xfb, 0x6c, 0x02, 0xff, 0xf2, 0x20, 0xdf, 0xc8, 0x06, 0xd6, 0x79,
+    0x5d, 0x07, 0xa6, 0x36, 0xd4, 0x37, 0x48, 0xa6, 0x69, 0x60, 0x2d, 0xaf, 0xb5, 0xfc, 0xec, 0x49,
+    0x29, 0x9a, 0x05, 0x20, 0x6c, 0x0a, 0x63, 0x49, 0xb2, 0x08, 0xf1, 0x2f, 0x15, 0xb2, 0xec, 0xeb,
+    0xae, 0x7c, 0xb8, 0x65, 0xe5, 0x20, 0xab, 0xec, 0xba, 0x9a, 0x03, 0x76, 0xaa, 0x88, 0x90, 0x58,
+    0x04, 0xf6, 0xd4, 0x59, 0x01, 0xda, 0x83, 0xed, 0x42, 0x7f, 0x94, 0xa1, 0xb9, 0x3d, 0xf5, 0xaf,
+    0x40, 0xbc, 0x60, 0xf4, 0xe5, 0x35, 0x8c, 0x02, 0xff, 0x04, 0x17, 0x63, 0xbb, 0x65, 0x75, 0xe8,
+    0x4f, 0xaf, 0xdf, 0x36, 0x51, 0x5a, 0x80, 0xb7, 0xf4, 0x43, 0x58, 0x1a, 0x3e, 0x08, 0x71, 0xc0,
+    0x5d, 0x3b, 0x72, 0x2e, 0x15, 0x84, 0xfc, 0x4b, 0x1e, 0xcc, 0x5c, 0x1c, 0x6d, 0xee, 0x4c, 0xa7,
+    0xdc, 0xd3, 0xf2, 0xe9, 0xf1, 0xd7, 0xec, 0x5b, 0x58, 0xb9, 0x3c, 0x60, 0x5f, 0x3f, 0x4e, 0x99,
+    0x37, 0x17, 0xb7, 0x3e, 0xde, 0x79, 0x56, 0x49, 0xda, 0xba, 0x63, 0x1e, 0x5d, 0xf1, 0xec, 0xc0,
+    0x85, 0xc9, 0x45, 0x50, 0xdd, 0x30, 0xb2, 0x83, 0xe8, 0x40, 0xb3, 0x3c, 0x61, 0x8d, 0x45, 0x91,
+    0xbf, 0x50, 0x89, 0xcf, 0x4e, 0xf3, 0xd8, 0x8e, 0x40, 0x3a, 0x6e, 0xba, 0xa0, 0x58, 0x0a, 0x08,
+    0xd3, 0x02, 0x82, 0x55, 0xcb, 0x61, 0xae, 0x07, 0x2a, 0xf7, 0x62, 0xd9, 0xde, 0xd9, 0xd9, 0xa9,
+    0x2d, 0xbc, 0x95, 0x72, 0x79, 0x61, 0x2f, 0xf7, 0xd9, 0x5e, 0x15, 0xae, 0x0e, 0xb0, 0x49, 0x2f,
+    0x92, 0xc5, 0x49, 0x4e, 0x56, 0xd9, 0xa0, 0x28, 0x4e, 0x28, 0x6f, 0xf0, 0xa4, 0x07, 0x9d, 0x18,
+    0xac, 0x74, 0x67, 0xaa, 0xa1, 0x46, 0x95, 0xca, 0x75, 0x85, 0xa8, 0x44, 0xe8, 0x4d, 0xa4, 0xed,
+    0xef, 0xdb, 0xb3, 0xe2, 0x64, 0x24, 0xa2, 0xd1, 0x6c, 0x9a, 0x30, 0xb0, 0xc7, 0x40, 0xc5, 0x4a,
+    0x5d, 0x57, 0x81, 0x60, 0x40, 0x77, 0xa8, 0xa2, 0x1e, 0xf9, 0xc0, 0xec, 0xc2, 0xdd, 0x98, 0x93,
+    0x26, 0x46, 0xee, 0x94, 0x2d, 0xeb, 0x4a, 0xfe, 0xc1, 0xba, 0x05, 0x66, 0xe3, 0x5f, 0xab, 0x9c,
+    0x11, 0x33, 0xc7, 0x75, 0x15, 0x0e, 0x64, 0x14, 0xe6, 0x97, 0x66, 0x14, 0x5c, 0xc7, 0xe3, 0x76,
+    0xd0, 0xbd, 0xc0, 0x11, 0x81, 0x5f, 0xad, 0x27, 0xd6, 0x94, 0x5f, 0x74, 0x40, 0x3f, 0xcf, 0xb6,
+    0x76, 0xb7, 0x77, 0xe9, 0xc2, 0xde, 0xb6, 0x06, 0x70, 0x31, 0xe0, 0xd3, 0xed, 0xdd, 0x61, 0xbb,
+    0x14, 0xdf, 0x7e, 0x81, 0x69, 0x68, 0x87, 0x24, 0xbf, 0x89, 0x55, 0xcc, 0xea, 0x0d, 0x43, 0xc6,
+    0xed, 0x90, 0x6b, 0xf9, 0xb8, 0xbb, 0xfd, 0xa5, 0x9e, 0x50, 0x50, 0x2e, 0xa1, 0x53, 0x90, 0xe3,
+    0xec, 0x92, 0xeb, 0x9b, 0x96, 0xdc, 0x93, 0x27, 0x4f, 0x4c, 0xba, 0xe8, 0xcc, 0x76, 0x3c, 0x76,
+    0x04, 0x38, 0x4e, 0x73, 0xfa, 0x68, 0x4c, 0x77, 0xf2, 0x43, 0x45, 0xfc, 0x3a, 0xea, 0xd2, 0x8a,
+    0xd4, 0xaf, 0x45, 0x45, 0x85, 0x0c, 0x8d, 0x96, 0x42, 0x00, 0x9f, 0xf7, 0xcd, 0xa4, 0x6c, 0xed,
+    0xa9, 0xa4, 0xd0, 0xc3, 0x2b, 0x39, 0xa1, 0xbb, 0x96, 0xe2, 0x2d, 0xb8, 0x1c, 0x85, 0xa0, 0x8b,
+    0x4a, 0x90, 0x74, 0x77, 0xb7, 0x20, 0x8d, 0x0a, 0x72, 0x26, 0xf5, 0x06, 0x1c, 0x79, 0x6d, 0x2f,
+    0xd9, 0xd1, 0x0a, 0x9a, 0x79, 0x39, 0x8e, 0xa0, 0x93, 0x11, 0xf2, 0x49, 0x54, 0x9c, 0x82, 0xda,
+    0x74, 0x23, 0x88, 0xb1, 0x80, 0x5c, 0xd3, 0x3e, 0xa6, 0xca, 0xa8, 0xd4, 0x38, 0x7e, 0x61, 0x59,
+    0x56, 0xb9, 0x54, 0x6e, 0x9b, 0x94, 0x99, 0xe7, 0x7b, 0x5c, 0x2b, 0x34, 0x1a, 0x83, 0x9b, 0xf3,
+    0x8f, 0x1c, 0x6f, 0xce, 0x03, 0x27, 0x3a, 0x30, 0x4a, 0xe3, 0xce, 0x7a, 0x53, 0x38, 0x59, 0x05,
+    0x21, 0x8e, 0xbb, 0xf4, 0x9d, 0xa2, 0x68, 0x65, 0x17, 0x91, 0x0d, 0xeb, 0x1c, 0xcc, 0xb6, 0x6e,
+    0x09, 0xdd, 0xdd, 0x40, 0xdf, 0xd7, 0x0e, 0xad, 0x63, 0x8f, 0x0d, 0x1e, 0x86, 0x5e, 0x52, 0xf6,
+    0xed, 0x09, 0xd2, 0xa1, 0x2e, 0x45, 0xe4, 0xc7, 0xcc, 0x0f, 0x40, 0xdc, 0xc8, 0x4d, 0x6f, 0x59,
+    0xbd, 0x27, 0x7b, 0x6d, 0x33, 0xac, 0x89, 0x13, 0x4c, 0x5c, 0x83, 0x57, 0xb6, 0x6b, 0x99, 0x34,
+    0xf7, 0xee, 0x3d, 0x3d, 0xb2, 0x6d, 0x55, 0x9c, 0x8b, 0xd3, 0x38, 0x50, 0xa7, 0xb1, 0xc0, 0x85,
+    0xe5, 0xa2, 0x44, 0x0d, 0x91, 0xa9, 0x32, 0x28, 0x99, 0xe5, 0xa2, 0xeb, 0xad, 0x16, 0xe3, 0x32,
+    0x27, 0x65, 0xb8, 0xa6, 0x8c, 0xa2, 0xa9, 0x48, 0xdd, 0x70, 0xf3, 0xb8, 0xae, 0x3d, 0xe6, 0x6e,
+    0x89, 0xa2, 0x2e, 0x0c, 0xeb, 0xa3, 0xe2, 0x8a, 0x40, 0xf4, 0xac, 0xde, 0x9e, 0x49, 0x2f, 0xbd,
+    0x44, 0x31, 0x78, 0xf9, 0xfc, 0x04, 0x43, 0x12, 0x27, 0xf2, 0xf3, 0xfe, 0xa3, 0xcb, 0xa7, 0xf5,
+    0xb4, 0x93, 0x59, 0xe6, 0x10, 0x44, 0xe0, 0x5f, 0x7d, 0x06, 0x1f, 0x74, 0x7d, 0x47, 0x0e, 0x70,
+    0xd3, 0x0b, 0xef, 0xd0, 0xe8, 0xbf, 0x0d, 0x0d, 0x2a, 0xcf, 0x2c, 0x9d, 0x39, 0x8d, 0xca, 0x2d,
+    0xfc, 0x73, 0x27, 0x2d, 0x14, 0xab, 0xd6, 0x41, 0xe2, 0x25, 0x56, 0xc5, 0xa2, 0x48, 0x5f, 0x4f,
+    0xbb, 0xd0, 0xf3, 0x21, 0x8c, 0x45, 0x8a, 0x1c, 0x55, 0x25, 0x82, 0x3a, 0x46, 0x45, 0xad, 0x25,
+    0x51, 0xaa, 0x70, 0x8a, 0x73, 0x06, 0xdb, 0xdb, 0x9d, 0xf8, 0x2f, 0x78, 0x1e, 0x6d, 0xa3, 0x23,
+    0xe0, 0x4f, 0x39, 0x7b, 0xe1, 0x4d, 0x9d, 0x89, 0x8d, 0xc2, 0x75, 0xe5, 0x80, 0xa7, 0xf2, 0xd2,
+    0xf9, 0xc3, 0x0a, 0xd0, 0xd7, 0x58, 0xc3, 0x05, 0xb4, 0xbe, 0xaf, 0x39, 0x24, 0x18, 0x4e, 0x32,
+    0xe2, 0xc7, 0xcd, 0x06, 0x05, 0x45, 0xff, 0x3d, 0xd1, 0xbb, 0xc4, 0xc4, 0x0a, 0x8b, 0x3a, 0xdb,
+    0x9b, 0x3d, 0x99, 0xd9, 0xe5, 0x46, 0x75, 0x2d, 0xdf, 0xbe, 0x48, 0xf9, 0xa4, 0xcc, 0x99, 0x1b,
+    0x6c, 0x95, 0xb2, 0x0d, 0x95, 0x60, 0x89, 0x82, 0x59, 0xd3, 0x7d, 0x42, 0x1e, 0x1b, 0x15, 0x9a,
+    0x4b, 0x42, 0xd0, 0x1d, 0x47, 0x06, 0xaf, 0x65, 0xcb, 0x68, 0x3f, 0x8a, 0x4f, 0x2a, 0x97, 0x60,
+    0x61, 0xe9, 0x14, 0x53, 0x21, 0x15, 0x36, 0x28, 0xcb, 0xc3, 0xc2, 0xf8, 0x6b, 0x3a, 0x19, 0x03,
+    0xdd, 0xf2, 0xde, 0xa8, 0x9b, 0xa0, 0x36, 0xd2, 0x33, 0x7e, 0x7f, 0x8e, 0x9e, 0x8b, 0xaa, 0x1a,
+    0xb2, 0xe2, 0x5a, 0xe0, 0x92, 0xd9, 0x8b, 0x2b, 0xf8, 0x0e, 0xfd, 0x9e, 0xb5, 0xdd, 0xae, 0x44,
+    0xa1, 0xb6, 0x1f, 0xb2, 0x6d, 0x54, 0x31, 0xaf, 0x6c, 0xf2, 0xd3, 0xd9, 0xaf, 0x03, 0x27, 0x1f,
+    0x6d, 0x2c, 0xc5, 0x83, 0xfb, 0x5a, 0x30, 0xd9, 0xbd, 0xd2, 0xfc, 0xd6, 0x4f, 0x4d, 0x28, 0x43,
+    0x17, 0x7b, 0x92, 0x33, 0x92, 0xe1, 0xc2, 0x6a, 0xb9, 0xe4, 0xc1, 0xa4, 0x20, 0x33, 0x6a, 0x7c,
+    0x62, 0xf5, 0x8c, 0x44, 0xc4, 0xbc, 0xb8, 0x40, 0x26, 0x19, 0x74, 0x22, 0x3e, 0x53, 0x54, 0x1e,
+    0xdc, 0xe9, 0x62, 0x66, 0x16, 0xd4, 0x0e, 0x47, 0xfd, 0xbf, 0x5a, 0x78, 0x21, 0xaa, 0xa1, 0x25,
+    0xb7, 0xa3, 0xd6, 0x56, 0x87, 0xf5, 0x67, 0x41, 0xbb, 0x96, 0x96, 0x54, 0x49, 0xae, 0x44, 0x74,
+    0x62, 0x07, 0x2a, 0xa2, 0x76, 0xb8, 0x84, 0xa9, 0x80, 0x65, 0x0e, 0xd3, 0x91, 0xd3, 0x2b, 0xb5,
+    0xb4, 0xa8, 0x46, 0x09, 0xe8, 0xac, 0xf1, 0x27, 0x5e, 0xcb, 0x94, 0x28, 0x9b, 0x3a, 0x81, 0x90,
+    0xa9, 0x7d, 0x26, 0x78, 0xba, 0xe9, 0xf5, 0x9e, 0xb3, 0x4b, 0x7b, 0x9f, 0x24, 0xe1, 0x98, 0x9b,
+    0x28, 0xbd, 0x26, 0xc9, 0x79, 0x0d, 0xc5, 0x55, 0x90, 0x91, 0x6f, 0xba, 0x44, 0x19, 0x7b, 0xd3,
+    0xea, 0xf6, 0x97, 0xd7, 0xed, 0xea, 0x11, 0x4d, 0x7e, 0x4d, 0x6e, 0x48, 0x53, 0xfc, 0x1a, 0x7b,
+    0x79, 0x55, 0x32, 0xb8, 0x0c, 0x38, 0xee, 0x6e, 0xd4, 0xf7, 0x21, 0x48, 0xf8, 0xab, 0x64, 0x7f,
+    0x6b, 0xa9, 0x93, 0x89, 0xab, 0x00, 0xfb, 0xe2, 0xbf, 0xf7, 0xd0, 0xed, 0x31, 0xe2, 0x53, 0x3f,
+    0xd2, 0x5b, 0xd5, 0x3d, 0x93, 0x51, 0xdd, 0x5b, 0xc7, 0xa6, 0xea, 0x86, 0xf4, 0x8a, 0xf9, 0xf9,
+    0xac, 0x72, 0xb4, 0xb4, 0x2a, 0xae, 0x24, 0xed, 0x63, 0x14, 0x1b, 0xb3, 0xcf, 0x91, 0x37, 0x0b,
+    0xc7, 0xc0, 0x38, 0x7f, 0x91, 0x58, 0x87, 0x73, 0x69, 0x04, 0xb2, 0x06, 0x62, 0x42, 0x4d, 0xba,
+    0x92, 0x04, 0xad, 0x2c, 0x09, 0x7d, 0x31, 0xb5, 0xc3, 0x39, 0xc4, 0x0a, 0x5f, 0x4c, 0x26, 0x93,
+    0x32, 0xe7, 0xce, 0xc6, 0x3f, 0x77, 0xf3, 0xdd, 0x24, 0x2a, 0x44, 0x75, 0xf8, 0xa9, 0x05, 0x6e,
+    0x2d, 0x99, 0xca, 0x62, 0xf6, 0x29, 0x85, 0xaa, 0x52, 0xf9, 0x26, 0x89, 0xf2, 0x44, 0x81, 0x1b,
+    0x77, 0x5c, 0xf2, 0x02, 0x8a, 0x46, 0xd2, 0xab, 0x70, 0x8c, 0x8b, 0xc1, 0xf3, 0x27, 0x75, 0xc8,
+    0xb2, 0x5c, 0x32, 0xef, 0x7d, 0x81, 0x06, 0xaf, 0xf2, 0xe7, 0xad, 0xbb, 0x3a, 0x1d, 0x5b, 0x25,
+    0xa9, 0x4a, 0xc7, 0x8d, 0xd8, 0x39, 0x30, 0x98, 0x83, 0x28, 0xe6, 0x92, 0x95, 0xf0, 0xe0, 0xbe,
+    0xde, 0x94, 0x80, 0x21, 0x81, 0xdf, 0xd7, 0x11, 0x01, 0xf7, 0x23, 0xfe, 0xab, 0xf3, 0x42, 0xea,
+    0x20, 0xb1, 0x46, 0x36, 0x3a, 0xe7, 0x14, 0x52, 0x67, 0x9a, 0x60, 0xdb, 0xf1, 0x78, 0xb0, 0x6e,
+    0xea, 0x55, 0xb3, 0xad, 0x98, 0x53, 0x25, 0x16, 0xfe, 0xd9, 0x60, 0x9c, 0xa8, 0x99, 0xa3, 0xc2,
+    0xea, 0xac, 0x67, 0xf7, 0x25, 0xe5, 0x60, 0xb2, 0x27, 0x1f, 0x14, 0xaa, 0xab, 0xb6, 0x80, 0x68,
+    0xa7, 0xa7, 0xb0, 0xe8, 0x5d, 0x3e, 0x8b, 0x0a, 0x1b, 0xf5, 0x72, 0xb7, 0xc8, 0x32, 0x70, 0xaf,
+    0x94, 0x79, 0x05, 0x2d, 0x6d, 0xf0, 0x34, 0x00, 0x93, 0x76, 0x39, 0x8d, 0xf3, 0xd5, 0x62, 0x7c,
+    0x17, 0x1a, 0x07, 0xa6, 0xdd, 0xac, 0xbe, 0x49, 0x55, 0x16, 0x9f, 0x94, 0x07, 0x62, 0xeb, 0xe4,
+    0x44, 0x91, 0xc1, 0xa6, 0xed, 0xa1, 0xa2, 0x57, 0xac, 0x4d, 0xc0, 0x66, 0xd3, 0x45, 0xd8, 0x74,
+    0x47, 0xdd, 0xef, 0x1e, 0xb4, 0x6b, 0x6a, 0x72, 0x0d, 0x9b, 0x2b, 0x02, 0xab, 0x27, 0xb5, 0x55,
+    0x5c, 0x6d, 0xd7, 0x00, 0xda, 0x05, 0xbe, 0xcb, 0x4e, 0x1c, 0xdb, 0x0d, 0x59, 0x97, 0x9d, 0xd9,
+    0x1f, 0x38, 0x8b, 0xe6, 0x7c, 0xc1, 0x66, 0x2b, 0x8f, 0xb4, 0x9b, 0xed, 0xb2, 0xc0, 0x8f, 0xec,
+    0xe0, 0x86, 0xf6, 0x3b, 0xa1, 0x6d, 0x5e, 0x11, 0xc6, 0x37, 0x0d, 0xca, 0x70, 0xd3, 0x8a, 0xac,
+    0xa8, 0xe5, 0x6b, 0xab, 0x5b, 0x89, 0x29, 0x84, 0x1c, 0xb6, 0x7b, 0x47, 0x55, 0xa7, 0xe9, 0x1a,
+    0x1b, 0x7e, 0x63, 0x8e, 0x66, 0xef, 0xce, 0x39, 0x9a, 0x61, 0x79, 0x78, 0x96, 0xd4, 0xfb, 0x30,
+    0x7b, 0x15, 0xf9, 0xeb, 0xc7, 0x36, 0x9b, 0x08, 0xef, 0x2a, 0x52, 0x45, 0xab, 0x10, 0x63, 0x72,
+    0xee, 0x82, 0x68, 0xa8, 0x1b, 0x61, 0x2a, 0x5b, 0xd7, 0x8e, 0x9b, 0x54, 0x00, 0x77, 0x57, 0xc3,
+    0xc5, 0x7d, 0x78, 0xa1, 0x87, 0x8b, 0xf7, 0x8d, 0x1b, 0xf7, 0xb1, 0xf4, 0xe9, 0x9e, 0xd4, 0xcf,
+    0x89, 0x83, 0x84, 0x3a, 0x93, 0x74, 0x9f, 0x7c, 0x16, 0x80, 0xd3, 0xde, 0x8d, 0x77, 0xcb, 0x41,
+    0xef, 0xb1, 0xcc, 0xe5, 0xa5, 0x1d, 0xb4, 0xba, 0x5d, 0xdb, 0xbb, 0x70, 0x79, 0x07, 0x77, 0x2f,
+    0xe1, 0x49, 0xbb, 0x93, 0xcd, 0x83, 0x6b, 0x5b, 0x28, 0xaa, 0xe9, 0x17, 0xcc, 0x0e, 0x63, 0x66,
+    0xd2, 0x2a, 0xe1, 0x6b, 0x8a, 0xe1, 0x5d, 0x98, 0x6b, 0xe0, 0xad, 0x89, 0xb5, 0x46, 0xce, 0xde,
+    0x8b, 0xb1, 0x1a, 0xd1, 0x4c, 0x48, 0xef, 0x97, 0x90, 0xae, 0xf1, 0x38, 0xef, 0x63, 0xd8, 0xf5,
+    0xa6, 0x49, 0xb1, 0xc6, 0x64, 0x8c, 0x3b, 0x4c, 0x31, 0xc9, 0xa5, 0xc9, 0xeb, 0x52, 0x4b, 0x90,
+    0x10, 0x3a, 0x28, 0x21, 0xf4, 0xd2, 0x76, 0x57, 0x7c, 0x4d, 0x4a, 0x8d, 0xce, 0xd3, 0x1a, 0xc4,
+    0xfe, 0xd4, 0x2a, 0xa7, 0xb3, 0x6f, 0x6d, 0xc0, 0xe2, 0xd5, 0xe6, 0x42, 0x55, 0x5a, 0xb3, 0xbf,
+    0x71, 0xf3, 0x2b, 0xea, 0x42, 0x5e, 0xd2, 0xb8, 0x85, 0xea, 0x10, 0x2d, 0x3e, 0x55, 0xc9, 0x82,
+    0xf5, 0xcb, 0x55, 0xaa, 0x99, 0x77, 0xc7, 0x1c, 0x6c, 0xdf, 0x1c, 0x57, 0xfd, 0xc0, 0xc3, 0xa5,
+    0x0f, 0x06, 0xe6, 0x92, 0x67, 0xc9, 0xfe, 0xab, 0x05, 0x87, 0x79, 0x60, 0xad, 0x6c, 0xd1, 0x22,
+    0x9a, 0xcf, 0xb6, 0xc2, 0x83, 0xb2, 0x4a, 0xc8, 0xac, 0x65, 0x2c, 0x4a, 0x4f, 0x49, 0xa5, 0xa5,
+    0x82, 0x64, 0x59, 0x1d, 0x8d, 0x5a, 0x4b, 0x53, 0x09, 0xc7, 0x58, 0x97, 0xa2, 0x14, 0x51, 0xdd,
+    0x17, 0x5d, 0xd3, 0x8e, 0xbc, 0xaa, 0x3d, 0xf6, 0x8a, 0x90, 0x4a, 0x33, 0x47, 0x71, 0x5a, 0x68,
+    0xe1, 0x4f, 0x6d, 0x57, 0xdd, 0xa6, 0x2c, 0xb8, 0x44, 0x89, 0xcf, 0x57, 0x2c, 0x7d, 0x49, 0x75,
+    0xca, 0xcc, 0xb9, 0xe6, 0x53, 0x8d, 0xea, 0xb4, 0xee, 0x1c, 0x11, 0xc5, 0xfa, 0xc8, 0x32, 0xdb,
+    0x81, 0x9c, 0x9f, 0xbe, 0x6d, 0x32, 0x86, 0xfd, 0x42, 0xb2, 0x74, 0xc3, 0x69, 0xe8, 0x41, 0xd9,
+    0x8e, 0xad, 0xed, 0xf6, 0xc2, 0x79, 0xdd, 0x2a, 0x81, 0x42, 0xdf, 0x18, 0x83, 0x92, 0xad, 0xac,
+    0x1a, 0x85, 0xbe, 0x96, 0x71, 0x67, 0xb7, 0x18, 0xac, 0xd7, 0x29, 0x3d, 0x1e, 0x6e, 0x97, 0x53,
+    0xdc, 0xd5, 0x56, 0xe7, 0xde, 0x63, 0xbf, 0x55, 0x0d, 0x0a, 0xd6, 0xca, 0xb9, 0xe6, 0x83, 0x06,
+    0xd0, 0x98, 0xdd, 0xa5, 0x33, 0xf9, 0xc0, 0x83, 0x8d, 0xee, 0x18, 0xed, 0x1a, 0x77, 0x8c, 0xf6,
+    0xaa, 0x22, 0x1c, 0xcb, 0x1c, 0xe1, 0xa4, 0xc8, 0x7e, 0x86, 0x6a, 0x0e, 0x73, 0x81, 0x5b, 0xdd,
+    0xc8, 0x22, 0xb1, 0x29, 0xba, 0x4a, 0x0f, 0x13, 0x65, 0xda, 0x48, 0x41, 0xb3, 0xe7, 0xda, 0x6f,
+    0x57, 0xa7, 0xe9, 0x61, 0xc9, 0x2f, 0x57, 0x51, 0xdd, 0x8c, 0x55, 0x5a, 0xdf, 0x70, 0xd7, 0x2d,
+    0x35, 0x85, 0xa7, 0x7a, 0xa9, 0xae, 0x5d, 0x00, 0xb8, 0x75, 0x67, 0x49, 0x11, 0xab, 0x4e, 0x98,
+    0xa4, 0x75, 0x73, 0xec, 0x79, 0xe2, 0x35, 0x50, 0x0b, 0x75, 0x0c, 0x85, 0xea, 0x87, 0x9a, 0xcc,
+    0x2c, 0x4a, 0xd6, 0x86, 0xf8, 0xb7, 0xa9, 0x1a, 0xc9, 0xd2, 0xe2, 0xba, 0x84, 0x1b, 0xbd, 0x65,
+    0xe0, 0x2c, 0x30, 0x81, 0xf2, 0x71, 0x8d, 0xfa, 0x52, 0x7d, 0x79, 0x81, 0x1e, 0x7e, 0xc8, 0x41,
+    0xeb, 0x4f, 0x2b, 0x46, 0xd0, 0xe5, 0x51, 0x2b, 0x03, 0xeb, 0x64, 0x8c, 0xaa, 0x45, 0x57, 0xb6,
+    0x6d, 0x89, 0xff, 0x3e, 0x7d, 0x2c, 0xdf, 0x5e, 0x7a, 0xfa, 0x58, 0xbc, 0x56, 0xf5, 0x14, 0x5f,
+    0x0f, 0x92, 0x2f, 0x36, 0x4d, 0x9d, 0x4b, 0x36, 0x71, 0xed, 0x30, 0x1c, 0x35, 0xb2, 0x9e, 0x5d,
+    0x23, 0x7d, 0xd7, 0xe9, 0xe9, 0xc3, 0x6e, 0x37, 0x7e, 0xab, 0xa3, 0xdb, 0xcd, 0xdc, 0xcf, 0x74,
+    0x15, 0x36, 0x24, 0xd3, 0x49, 0x6d, 0x90, 0x7b, 0xb1, 0x42, 0x69, 0x87, 0x3f, 0x47, 0xe2, 0x39,
+    0x3b, 0xc3, 0xe7, 0x85, 0xa7, 0x3a, 0x48, 0x18, 0x1f, 0x6a, 0x00, 0x99, 0x9a, 0x63, 0x05, 0x7d,
+    0x83, 0x39, 0xd3, 0xe4, 0xce, 0x29, 0xde, 0x38, 0x7c, 0xfa, 0x18, 0xda, 0x16, 0xa1, 0x68, 0x6e,
+    0xeb, 0x6e, 0x65, 0xc6, 0x91, 0x05, 0xec, 0x8d, 0x43, 0xb8, 0xe8, 0x31, 0x7a, 0x7f, 0x2c, 0xd7,
+    0x5e, 0xfe, 0x9a, 0xe7, 0xaa, 0x08, 0x41, 0x4c, 0x4c, 0x25, 0x0f, 0x58, 0xe5, 0xe9, 0xbc, 0x2f,
+    0x5f, 0x52, 0x83, 0xc9, 0xec, 0x57, 0x80, 0xcf, 0x14, 0x7b, 0x9b, 0xc6, 0xc8, 0x14, 0x7e, 0xab,
+    0x23, 0x49, 0xa7, 0x39, 0xd3, 0x50, 0xdc, 0x11, 0x5c, 0x84, 0xdf, 0x05, 0x68, 0xcd, 0x1c, 0xa8,
+    0x03, 0x88, 0x02, 0xdd, 0xa4, 0xdf, 0xb1, 0xf8, 0xd5, 0xc8, 0x7b, 0xa5, 0x37, 0x78, 0xd6, 0x75,
+    0xe6, 0x39, 0xf1, 0xbf, 0xe5, 0x2c, 0x2f, 0x17, 0x27, 0x42, 0x99, 0x36, 0x0e, 0xfb, 0x03, 0xcb,
+    0x30, 0x96, 0x0e, 0x0a, 0x45, 0x7e, 0x8d, 0x43, 0xb8, 0x5c, 0x47, 0x38, 0x04, 0x6f, 0x2a, 0x26,
+    0xa4, 0x50, 0xe5, 0x6a, 0x9a, 0x96, 0x4c, 0xc5, 0x6b, 0xc9, 0xa2, 0x92, 0x45, 0xad, 0x15, 0x33,
+    0x00, 0xad, 0x04, 0x4b, 0xe0, 0xc2, 0xaa, 0xc5, 0xf5, 0x6c, 0x8f, 0xfe, 0xda, 0x3d, 0x06, 0x6b,
+    0xf7, 0x18, 0xae, 0xdd, 0x63, 0x6b, 0xed, 0x1e, 0xdb, 0x6b, 0xf7, 0xd8, 0xd1, 0xf6, 0xa8, 0xb3,
+    0xac, 0xab, 0xab, 0x4d, 0x4d, 0xf3, 0x9e, 0xad, 0x3c, 0x2d, 0x99, 0xf8, 0x7c, 0x71, 0xa9, 0xc0,
+    0x18, 0xef, 0x25, 0x63, 0x56, 0x88, 0x44, 0x52, 0xa2, 0xd9, 0x38, 0xfc, 0xef, 0x7f, 0xfb, 0xf3,
+    0x7f, 0xd4, 0x60, 0x4c, 0x52, 0x97, 0xd9, 0x38, 0x14, 0x94, 0x98, 0xfa, 0xe4, 0xb5, 0x46, 0x5a,
+    0x62, 0x27, 0xd9, 0x4a, 0xbf, 0x1f, 0x45, 0xc9, 0xc0, 0xea, 0xb2, 0xd1, 0xad, 0x2f, 0x2d, 0x8f,
+    0xa9, 0x3e, 0x38, 0x2e, 0xab, 0x08, 0x8d, 0x0c, 0x55, 0x8a, 0xef, 0x4a, 0x78, 0x9a, 0xab, 0xaf,
+    0x6b, 0x1c, 0xbe, 0x0a, 0x78, 0x77, 0x8a, 0xc6, 0x68, 0xe1, 0x78, 0x7c, 0x2a, 0xac, 0x75, 0x1c,
+    0x8b, 0x87, 0x15, 0xb6, 0x20, 0x5b, 0xe5, 0x26, 0xe8, 0x96, 0x77, 0xb0, 0x36, 0x50, 0x37, 0x35,
+    0x48, 0x50, 0x42, 0xca, 0x15, 0xbe, 0xeb, 0x35, 0xe6, 0xe0, 0x07, 0x2d, 0x57, 0x68, 0xd5, 0xa7,
+    0x6c, 0x7c, 0xc3, 0x7e, 0x63, 0x5f, 0xda, 0xe7, 0x93, 0xc0, 0x59, 0x46, 0x39, 0x52, 0x75, 0xec,
+    0xa9, 0x20, 0x2c, 0x9f, 0x56, 0x58, 0x8b, 0x94, 0x72, 0x11, 0xc9, 0x95, 0xcc, 0xe5, 0x6b, 0x5a,
+    0x04, 0x13, 0xc4, 0x3d, 0x49, 0x27, 0xc9, 0x40, 0xa5, 0x3e, 0x8e, 0x4b, 0x0f, 0x1a, 0x87, 0x8f,
+    0x6a, 0x6a, 0xf0, 0x6c, 0x84, 0x11, 0x13, 0x7b, 0x67, 0x23, 0xaf, 0x95, 0xbc, 0x67, 0x1e, 0x78,
+    0x94, 0xb4, 0xdd, 0xf6, 0x4a, 0xd4, 0x74, 0x7c, 0x02, 0xe9, 0x4b, 0xc7, 0x90, 0x75, 0x23, 0x77,
+    0x11, 0x39, 0xea, 0xf8, 0xeb, 0x35, 0x27, 0x4e, 0x14, 0xb4, 0x35, 0xd8, 0xd4, 0x8e, 0xec, 0xae,
+    0x84, 0x31, 0x6a, 0x04, 0xb6, 0xe3, 0x8d, 0xb5, 0x96, 0xc6, 0x04, 0x4c, 0x16, 0xad, 0x19, 0x7a,
+    0x14, 0x7b, 0xa5, 0xd5, 0x31, 0xa8, 0x1a, 0xfe, 0xfe, 0xef, 0xca, 0xa6, 0xfb, 0x2e, 0x92, 0xf0,
+    0x83, 0xa0, 0xa0, 0xbe, 0x28, 0x94, 0x71, 0x49, 0x65, 0xcf, 0x38, 0xe0, 0x76, 0x34, 0x87, 0x88,
+    0xea, 0xb3, 0x31, 0xe8, 0xcf, 0xff, 0xb9, 0x69, 0x06, 0x1d, 0xc5, 0x34, 0x7c, 0x1a, 0x16, 0x4d,
+    0xe6, 0x10, 0xac, 0x7d, 0x36, 0xf6, 0xfc, 0xe3, 0xdf, 0x6c, 0x9a, 0x3d, 0xc7, 0x88, 0xff, 0xa7,
+    0x61, 0x0d, 0x6e, 0x1a, 0x7e, 0x70, 0x3f, 0x17, 0x73, 0xfe, 0xf2, 0xaf, 0x1b, 0x17, 0x9d, 0x73,
+    0x41, 0xc0, 0x27, 0xe2, 0x4e, 0x14, 0xf8, 0xe3, 0xcf, 0xc6, 0x9c, 0x7f, 0xf9, 0xf7, 0x8d, 0x33,
+    0x87, 0xf0, 0xff, 0x34, 0xbc, 0x99, 0x41, 0xd4, 0xfd, 0xf9, 0x74, 0xf2, 0xdf, 0x6e, 0x9a, 0x35,
+    0xa7, 0x80, 0xfe, 0x66, 0x6d, 0x73, 0xae, 0x66, 0xd0, 0x18, 0xf3, 0x66, 0xea, 0x07, 0xeb, 0x9b,
+    0x64, 0x02, 0x4d, 0xe9, 0x8b, 0x0a, 0x53, 0x9c, 0x2d, 0x2d, 0xac, 0x0a, 0x8e, 0xd3, 0xa6, 0x35,
+    0xa6, 0x51, 0x2d, 0xf6, 0xab, 0x39, 0x8f, 0xd9, 0x4a, 0x39, 0x63, 0x10, 0x54, 0xd6, 0x11, 0xcb,
+    0xcf, 0x64, 0xf0, 0x0e, 0xf8, 0xbe, 0xc6, 0x5f, 0xfb, 0xa5, 0x80, 0x6a, 0x0a, 0x43, 0xb6, 0xee,
+    0xaa, 0x71, 0xf8, 0x53, 0xf7, 0xd9, 0xb5, 0x13, 0xde, 0x7d, 0x9d, 0xfc, 0xaf, 0xe5, 0xe5, 0x60,
+    0xf3, 0xbc, 0x7c, 0xf3, 0x7f, 0x95, 0x97, 0xc3, 0xcd, 0xf3, 0xf2, 0xe7, 0x35, 0x79, 0x59, 0x47,
+    0x4d, 0x29, 0x95, 0x7f, 0x06, 0x3d, 0xa5, 0x96, 0xf7, 0x95, 0xe8, 0xaa, 0x6c, 0x7d, 0x5d, 0x85,
+    0xce, 0xa1, 0x26, 0x82, 0x6b, 0x98, 0x46, 0x3c, 0xa1, 0x5f, 0xc9, 0xac, 0x40, 0xa4, 0x3b, 0x6a,
+    0x0c, 0xad, 0xf8, 0x37, 0xfb, 0x1a, 0x7f, 0x8b, 0x7f, 0xa5, 0x2a, 0x15, 0x7a, 0x5c, 0xcd, 0xc0,
+    0xb4, 0x24, 0xac, 0xc1, 0x28, 0xf5, 0x3c, 0x6a, 0xc8, 0x62, 0xa8, 0x7d, 0x2a, 0xa3, 0x3a, 0x28,
+    0x9f, 0x25, 0x15, 0x52, 0x9a, 0x4a, 0x5f, 0xaf, 0x9f, 0x30, 0x5c, 0xdf, 0xac, 0xd3, 0x85, 0xa8,
+    0x6c, 0x1c, 0x0e, 0xad, 0xbb, 0xaf, 0x9d, 0xb4, 0x9a, 0xa5, 0x71, 0x78, 0x66, 0x7b, 0x2b, 0xdb,
+    0x65, 0xaf, 0x45, 0xbe, 0xd6, 0x24, 0x2a, 0x9b, 0x9d, 0xd5, 0x31, 0xed, 0xd0, 0x7b, 0x3c, 0x0c,
+    0xd5, 0xa9, 0xb5, 0x7a, 0xfd, 0xec, 0xdc, 0xe2, 0xe1, 0x67, 0xb9, 0xb9, 0xb5, 0x7a, 0x3b, 0xf7,
+    0x9c, 0xdc, 0xfe, 0x70, 0xfb, 0x73, 0x4f, 0xef, 0x5f, 0xfe, 0xf9, 0x4f, 0x77, 0x98, 0xe0, 0x1d,
+    0xeb, 0xcb, 0xcd, 0xcc, 0xf0, 0x51, 0xc2, 0xed, 0xcf, 0x35, 0xbf, 0x21, 0xa7, 0x8d, 0xb0, 0x4b,
+    0x27, 0xba, 0x29, 0x4e, 0xb0, 0x95, 0x9b, 0x61, 0xab, 0x37, 0x28, 0x4c, 0xb1, 0xb5, 0x7d, 0xcf,
+    0x39, 0xde, 0xde, 0xf9, 0xec, 0x53, 0xfc, 0xa7, 0x7f, 0xba, 0xc3, 0x14, 0x23, 0xa9, 0x9b, 0x99,
+    0xe3, 0xf3, 0x94, 0xe3, 0x2c, 0x9a, 0x07, 0x3c, 0x9c, 0xfb, 0xee, 0xf4, 0x8e, 0x9a, 0x3f, 0x5b,
+    0x74, 0x56, 0xba, 0xef, 0x93, 0x64, 0x82, 0x78, 0x18, 0xcd, 0x79, 0xe4, 0x4c, 0x7a, 0x19, 0xf0,
+    0x59, 0xd0, 0xc2, 0xa0, 0xe4, 0xdf, 0x32, 0x3b, 0xa3, 0xca, 0xa0, 0x18, 0xbe, 0x92, 0xc7, 0x8d,
+    0x05, 0x29, 0x97, 0x8e, 0xa3, 0x1e, 0x0d, 0x63, 0x52, 0x3a, 0x2d, 0x6e, 0x29, 0xcf, 0x4a, 0x27,
+    0xe5, 0x24, 0x10, 0x30, 0x63, 0x3e, 0x81, 0x2b, 0x98, 0x55, 0xaf, 0x08, 0xa5, 0xe4, 0x43, 0xb7,
+    0x2c, 0x44, 0xdd, 0x40, 0x74, 0xb3, 0xe4, 0xb2, 0x43, 0x43, 0xd7, 0x5d, 0x12, 0x89, 0x77, 0x60,
+    0x11, 0x48, 0xf9, 0xff, 0xe2, 0xf4, 0xd4, 0x82, 0x9f, 0x8d, 0x40, 0xed, 0x67, 0xa1, 0xee, 0x9e,
+    0x6e, 0x08, 0xea, 0x20, 0x0b, 0xf5, 0x74, 0x53, 0x50, 0x87, 0x29, 0x54, 0xcb, 0xda, 0x18, 0xd4,
+    0xad, 0x2c, 0x54, 0x84, 0xbb, 0x11, 0xa8, 0xdb, 0x29, 0xd4, 0xad, 0x23, 0xcb, 0xda, 0x1b, 0x6c,
+    0x04, 0xea, 0x4e, 0x0a, 0xf5, 0xc9, 0x96, 0x65, 0x9d, 0x0c, 0x1b, 0x35, 0x74, 0x75, 0x76, 0x14,
+    0xda, 0xfc, 0xd0, 0xc5, 0xb1, 0xa2, 0x8e, 0x25, 0x97, 0xe7, 0xff, 0x0e, 0x6e, 0xbf, 0x10, 0x77,
+    0x97, 0xae, 0x3d, 0xe1, 0xa8, 0x30, 0x78, 0x30, 0x6a, 0xc4, 0xeb, 0xf3, 0x3b, 0xb1, 0xc3, 0x5e,
+    0xb1, 0x92, 0x64, 0x89, 0x48, 0xa3, 0x72, 0x97, 0x25, 0xad, 0xfd, 0x48, 0xaa, 0x11, 0x24, 0xe5,
+    0xb6, 0x37, 0xe1, 0x2e, 0xa5, 0xda, 0x8f, 0xe9, 0x52, 0xbf, 0xe1, 0x52, 0x0a, 0x52, 0x16, 0x50,
+    0x48, 0x80, 0xb4, 0xa8, 0x05, 0x40, 0xba, 0xac, 0xb5, 0x83, 0x63, 0xd2, 0x5c, 0x21, 0x6d, 0x68,
+    0xa4, 0xed, 0x80, 0x39, 0xf1, 0xf1, 0x2f, 0x27, 0x60, 0xb4, 0xd8, 0x88, 0x7d, 0xbc, 0x3d, 0xc8,
+    0x3d, 0x75, 0xc2, 0x93, 0xc0, 0xbe, 0xb8, 0x70, 0xbc, 0x0b, 0x78, 0x38, 0x03, 0xe7, 0x99, 0x1f,
+    0x68, 0x7b, 0xe3, 0xbb, 0x22, 0x23, 0xe6, 0xad, 0x5c, 0xf7, 0x20, 0x53, 0x53, 0xf9, 0x98, 0xbd,
+    0x0a, 0xf8, 0x94, 0xcf, 0x68, 0x47, 0x27, 0xde, 0x00, 0x79, 0x90, 0x16, 0x64, 0x78, 0x61, 0x94,
+    0xdc, 0x86, 0xee, 0x6f, 0x73, 0x34, 0x7d, 0xc4, 0xb9, 0xde, 0x67, 0x0d, 0x99, 0x48, 0x6e, 0x74,
+    0xc4, 0x9e, 0x50, 0xb8, 0xcf, 0xde, 0x26, 0x6a, 0xa5, 0xc3, 0x12, 0x5d, 0x20, 0x2e, 0x4f, 0xe3,
+    0x4b, 0xb9, 0xea, 0xc4, 0x25, 0x2d, 0x15, 0xbc, 0x94, 0xf2, 0x8d, 0x97, 0x52, 0x28, 0xdf, 0xdd,
+    0x76, 0xb4, 0xa3, 0x7e, 0x3f, 0xe1, 0xb6, 0x97, 0x1f, 0xd3, 0xb2, 0xfa, 0xa7, 0xc3, 0x53, 0x09,
+    0x72, 0x77, 0xeb, 0xe4, 0x09, 0x5d, 0xee, 0x9e, 0x9e, 0x1c, 0x49, 0xe8, 0xc3, 0x27, 0xc7, 0xf0,
+    0x43, 0x97, 0x83, 0xe7, 0xc7, 0xc7, 0x5b, 0x72, 0xf8, 0x3e, 0x60, 0x98, 0xe2, 0x07, 0x6d, 0x4d,
+    0x63, 0x9e, 0x3a, 0x01, 0x57, 0x87, 0x4c, 0xc8, 0xdc, 0x3b, 0xca, 0x50, 0x9c, 0xb9, 0xdc, 0xda,
+    0x4e, 0x2e, 0xf7, 0x8e, 0x93, 0xcb, 0x93, 0x5d, 0xab, 0xd6, 0x90, 0xc7, 0x60, 0x62, 0xfc, 0xe5,
+    0xdc, 0xd7, 0x0d, 0x3c, 0x1c, 0x26, 0xec, 0xdb, 0xd9, 0x91, 0x97, 0xc3, 0x61, 0x72, 0xb9, 0xb3,
+    0x23, 0x69, 0xb5, 0xac, 0xe3, 0x63, 0xc9, 0x81, 0x9d, 0x1d, 0x1a, 0xad, 0xc6, 0xc0, 0xe7, 0x2b,
+    0x2f, 0xe4, 0x51, 0x7e, 0xd0, 0xc1, 0x49, 0xff, 0x68, 0x47, 0x70, 0xb5, 0xdf, 0x1f, 0x0c, 0xb7,
+    0x9f, 0x89, 0xcb, 0xe7, 0xc3, 0x67, 0x7b, 0xe2, 0x72, 0x78, 0xb4, 0x37, 0x38, 0x15, 0xe3, 0x9f,
+    0x6e, 0x3f, 0x79, 0x6e, 0x1d, 0x89, 0xcb, 0x27, 0xbb, 0xc3, 0xbe, 0xb8, 0x7b, 0x72, 0x3c, 0xd8,
+    0x19, 0xec, 0x98, 0xa9, 0xbd, 0x19, 0xf3, 0x60, 0xb9, 0xf2, 0x3e, 0x14, 0x85, 0x29, 0xc1, 0x1a,
+    0x04, 0x24, 0xe5, 0xf2, 0x56, 0x2a, 0x4c, 0xa7, 0xf1, 0xcc, 0xef, 0x59, 0xc9, 0xe5, 0x56, 0x7c,
+    0xb9, 0x27, 0x44, 0xcc, 0x34, 0xee, 0x2b, 0x8e, 0x45, 0xe4, 0xe0, 0x32, 0x46, 0x25, 0x52, 0x9c,
+    0xe1, 0xdc, 0xda, 0x77, 0x4d, 0x03, 0x27, 0xce, 0x4c, 0x71, 0x76, 0x25, 0x95, 0x47, 0xd6, 0xf1,
+    0xd6, 0xc9, 0xf3, 0xe2, 0x08, 0xcf, 0xb6, 0x8b, 0x6b, 0x2a, 0x37, 0xae, 0x9c, 0xdd, 0x64, 0xd8,
+    0x77, 0xf9, 0x85, 0xff, 0x42, 0x9c, 0xfb, 0xec, 0xfc, 0xc2, 0x93, 0xbb, 0x4e, 0x72, 0x2b, 0xde,
+    0x7a, 0x6d, 0x65, 0x4a, 0xa7, 0x40, 0x1a, 0x56, 0xcb, 0xe7, 0x97, 0xa0, 0x4c, 0x5e, 0x3a, 0x21,
+    0x48, 0x25, 0x0f, 0xf2, 0x8f, 0xf1, 0x90, 0xd9, 0xf3, 0xc8, 0x8e, 0x56, 0xe1, 0x79, 0x04, 0x9a,
+    0x70, 0x81, 0x0f, 0x93, 0xa7, 0xf1, 0xfb, 0x7b, 0xda, 0x31, 0x8a, 0x27, 0x99, 0xa6, 0x6a, 0x87,
+    0x0e, 0x8f, 0x19, 0xb1, 0xa9, 0x3f, 0x59, 0x2d, 0x60, 0xe8, 0xde, 0x05, 0x8f, 0x9e, 0xbb, 0x1c,
+    0x2f, 0x8f, 0x6e, 0x5e, 0x4c, 0x5b, 0xcd, 0x4c, 0xb3, 0x66, 0x76, 0x40, 0x51, 0xd4, 0x27, 0x46,
+    0xe8, 0xcd, 0xfc, 0xe0, 0xb9, 0x3d, 0x99, 0xb7, 0x5a, 0xf2, 0x0e, 0x9e, 0x7a, 0x3d, 0xe5, 0xd7,
+    0x6d, 0x36, 0x3a, 0xd4, 0xd4, 0xa6, 0xe7, 0xc6, 0x3f, 0xc6, 0x2d, 0xc0, 0xcc, 0xf8, 0x42, 0xdf,
+    0x4b, 0x14, 0x5a, 0x4d, 0xd0, 0xdd, 0xcd, 0xb6, 0xae, 0x4c, 0x3e, 0xe9, 0xdc, 0x23, 0xfb, 0x81,
+    0xf6, 0x0d, 0xc0, 0x34, 0xb3, 0xb9, 0xeb, 0x26, 0x7b, 0xc4, 0x5a, 0x84, 0x08, 0x1b, 0x8d, 0x46,
+    0xcc, 0x62, 0xdf, 0xb0, 0xa6, 0xdc, 0x6d, 0x6c, 0x32, 0x3c, 0xc7, 0xb5, 0x02, 0x30, 0x86, 0x31,
+    0x30, 0x29, 0x3d, 0x09, 0x42, 0xd0, 0xa4, 0xb0, 0x20, 0x43, 0x8f, 0x3c, 0x33, 0x63, 0x7d, 0x5a,
+    0x44, 0x47, 0x3d, 0x1d, 0xf2, 0x61, 0xd3, 0x88, 0xa9, 0x28, 0x96, 0x4d, 0xa7, 0x40, 0x94, 0x0d,
+    0x68, 0xf9, 0x9e, 0xe2, 0x8a, 0xc7, 0x64, 0xac, 0x8d, 0x27, 0x55, 0x8b, 0xfa, 0x91, 0x1e, 0x4f,
+    0x78, 0xd0, 0x34, 0x77, 0xa1, 0x88, 0xae, 0x97, 0xc6, 0x64, 0xa2, 0x94, 0x62, 0x24, 0x56, 0xa4,
+    0xbe, 0x5b, 0xcc, 0x15, 0x1b, 0x14, 0x07, 0x74, 0x98, 0x3b, 0xee, 0xb4, 0x05, 0xa0, 0x34, 0x78,
+    0xdd, 0xb6, 0x8d, 0x73, 0xe2, 0x09, 0x2c, 0xd7, 0x24, 0x14, 0x7b, 0xe9, 0xa9, 0xc4, 0x27, 0x4d,
+    0x43, 0x07, 0xf4, 0xd6, 0x8e, 0x65, 0x39, 0xfe, 0x28, 0x99, 0x1d, 0x7c, 0xa4, 0x41, 0x2f, 0x2b,
+    0x66, 0x59, 0x0a, 0x25, 0xd5, 0x15, 0x82, 0x99, 0xed, 0x81, 0x03, 0x98, 0x9b, 0xe3, 0xb2, 0xcd,
+    0x0f, 0x90, 0x82, 0x69, 0x57, 0xe1, 0x35, 0x9d, 0xe6, 0xb4, 0x51, 0xab, 0x39, 0x71, 0xc1, 0xc7,
+    0x6d, 0x76, 0x58, 0x8b, 0x16, 0xb6, 0x78, 0xd3, 0x53, 0x6a, 0x19, 0xb1, 0xce, 0xd4, 0x37, 0x0e,
+    0x6f, 0xf5, 0x45, 0xd9, 0x89, 0xb2, 0xd2, 0xaa, 0x3c, 0x45, 0x72, 0x41, 0x95, 0x62, 0x55, 0xa1,
+    0x70, 0xfa, 0xf2, 0xa5, 0xcb, 0x26, 0x9d, 0x95, 0x54, 0x0a, 0x36, 0xdb, 0x95, 0x54, 0x14, 0x97,
+    0x49, 0x88, 0xcc, 0xf2, 0x17, 0x0b, 0x08, 0x89, 0x09, 0x94, 0x4e, 0x44, 0x6c, 0xaa, 0x96, 0xe0,
+    0x80, 0x58, 0x4b, 0x43, 0xb2, 0x8a, 0xbf, 0xf2, 0x5e, 0xcd, 0x3a, 0xa4, 0xa8, 0x15, 0x2c, 0x77,
+    0xa2, 0xa8, 0x1e, 0x74, 0x0a, 0xc8, 0x01, 0x3e, 0x49, 0x3e, 0x02, 0xc7, 0x91, 0x5a, 0x4d, 0x7c,
+    0x3d, 0xa5, 0x59, 0x83, 0x48, 0x59, 0x6e, 0x86, 0x65, 0x5b, 0x6b, 0x51, 0x98, 0x14, 0x68, 0xdd,
+    0x7f, 0xb2, 0x02, 0x0e, 0x02, 0x55, 0x07, 0xd7, 0x42, 0xb1, 0x8b, 0x14, 0x66, 0xc7, 0x84, 0xf4,
+    0x1f, 0x56, 0x3c, 0xb8, 0x39, 0xa7, 0x36, 0x7e, 0xf0, 0xcc, 0x75, 0x5b, 0xcd, 0xb7, 0xd9, 0x7d,
+    0xd1, 0x77, 0x80, 0x7b, 0xa2, 0x80, 0xc9, 0xa0, 0x69, 0xed, 0x5e, 0x9d, 0x55, 0xa5, 0x57, 0xdb,
+    0x80, 0xf3, 0x0f, 0x7c, 0xe1, 0x5f, 0x72, 0x69, 0xbf, 0x44, 0xd0, 0xc4, 0xe8, 0x9d, 0x61, 0x2c,
+    0x4e, 0x8f, 0xc9, 0xc0, 0x21, 0x42, 0x83, 0x1a, 0xbe, 0x03, 0x29, 0x88, 0xd0, 0x24, 0x23, 0x10,
+    0x01, 0xe1, 0xd0, 0x6a, 0x4a, 0x23, 0xda, 0x36, 0x58, 0x09, 0xe4, 0xf0, 0x74, 0x9a, 0x47, 0x35,
+    0xf2, 0x19, 0x11, 0x8a, 0x95, 0x6d, 0x80, 0xa4, 0xde, 0x38, 0x25, 0xe6, 0x3c, 0x15, 0xbf, 0x78,
+    0x28, 0xe3, 0x48, 0xe7, 0x20, 0x01, 0x29, 0xfd, 0x42, 0x14, 0xb4, 0x6d, 0x73, 0xa2, 0x12, 0x6f,
+    0x68, 0xa3, 0x8f, 0x30, 0xc9, 0x1a, 0x7b, 0xf9, 0xc0, 0x60, 0x67, 0xaa, 0x04, 0x4b, 0xa4, 0xc1,
+    0x64, 0x18, 0x5d, 0x73, 0x85, 0xc7, 0x11, 0xf3, 0x67, 0x5d, 0xda, 0xf1, 0x4c, 0xd6, 0x5a, 0xdd,
+    0xe6, 0x41, 0xe2, 0xe0, 0xbc, 0x14, 0x77, 0xd1, 0xea, 0x38, 0x8b, 0x90, 0x86, 0x75, 0x14, 0x41,
+    0xd3, 0x7b, 0x18, 0x36, 0x2d, 0xc4, 0x3c, 0xfb, 0xc8, 0x52, 0x60, 0x93, 0x17, 0x99, 0x16, 0xad,
+    0x3a, 0xe6, 0xa5, 0xd8, 0x49, 0xeb, 0x0e, 0x4f, 0x69, 0x63, 0x6c, 0x54, 0xb6, 0x4e, 0xe8, 0xb5,
+    0xe1, 0x82, 0x13, 0x4c, 0x1d, 0x93, 0x25, 0x43, 0x67, 0x46, 0x68, 0x67, 0x0a, 0x93, 0x05, 0xe4,
+    0xc3, 0x3f, 0xc3, 0xac, 0x36, 0x8c, 0x64, 0x1d, 0x68, 0xdb, 0xc8, 0x84, 0xc2, 0x6f, 0xe9, 0x1d,
+    0x6d, 0x74, 0x24, 0x82, 0x90, 0x9f, 0xba, 0xbe, 0x1d, 0x11, 0xec, 0x44, 0x4e, 0x29, 0xb5, 0xd4,
+    0x66, 0x7f, 0xfc, 0xa3, 0x0e, 0x8e, 0x20, 0x09, 0xc2, 0xad, 0x2a, 0x28, 0xd0, 0xa4, 0x02, 0x86,
+    0x7d, 0x5d, 0x09, 0xc3, 0xbe, 0x26, 0x18, 0x7d, 0x7c, 0xa9, 0xa5, 0xf8, 0x22, 0x6a, 0x3c, 0x19,
+    0x84, 0xf0, 0x6b, 0x9f, 0xa8, 0x6f, 0x49, 0xec, 0xcb, 0x7c, 0x54, 0xcf, 0x0f, 0x16, 0x14, 0xc7,
+    0x60, 0x78, 0x20, 0x3a, 0xb0, 0x6e, 0x42, 0x53, 0x9b, 0x3d, 0xa6, 0x37, 0x87, 0x7f, 0xab, 0xde,
+    0xd7, 0xeb, 0x89, 0x00, 0x24, 0x01, 0xd4, 0x43, 0x06, 0xe6, 0xd7, 0x6c, 0xb0, 0x6b, 0x1d, 0xa0,
+    0xe0, 0xc1, 0xff, 0x6c, 0xca, 0x2f, 0x02, 0xce, 0x43, 0xe6, 0xcf, 0xe8, 0xf8, 0x93, 0x82, 0x21,
+    0x50, 0x24, 0xac, 0x40, 0x1c, 0xed, 0x54, 0xbc, 0xf6, 0x09, 0x85, 0x16, 0xfd, 0xb2, 0x06, 0x71,
+    0x67, 0x76, 0x34, 0x47, 0x2e, 0xb6, 0xac, 0x8e, 0xbc, 0x76, 0xbc, 0x56, 0xbf, 0x23, 0x80, 0x32,
+    0x42, 0xb0, 0x5d, 0x4e, 0x57, 0x32, 0xd3, 0x10, 0xf0, 0xe4, 0x68, 0xd4, 0xb2, 0x48, 0xa7, 0xdb,
+    0x4a, 0x68, 0x5b, 0x2d, 0x61, 0xa6, 0x39, 0x2e, 0xa3, 0x8a, 0x69, 0xcb, 0x0b, 0x6e, 0x42, 0x55,
+    0x3c, 0x6e, 0x86, 0xb8, 0x18, 0xab, 0x8e, 0x90, 0x0a, 0x13, 0x75, 0x82, 0x57, 0xb6, 0x5c, 0x2f,
+    0x39, 0x01, 0xca, 0x0e, 0xa6, 0x73, 0x64, 0xd3, 0xee, 0xe2, 0xa0, 0x90, 0x11, 0xad, 0xd3, 0xfc,
+    0xa2, 0x96, 0x2b, 0x5a, 0x6c, 0x3b, 0x35, 0x4b, 0x71, 0xa0, 0xb1, 0xe5, 0xdb, 0x1d, 0xa5, 0xb0,
+    0xa8, 0x61, 0xd3, 0x84, 0x11, 0x8d, 0x24, 0xa3, 0x21, 0x58, 0x3a, 0xaf, 0x02, 0x7f, 0xc9, 0x83,
+    0xe8, 0xa6, 0xd5, 0x94, 0x7b, 0x5d, 0xcd, 0x78, 0xd2, 0x1f, 0xb1, 0x26, 0x88, 0xa4, 0x11, 0x0e,
+    0x48, 0xed, 0x8f, 0x34, 0x2b, 0x02, 0xb1, 0xf8, 0x25, 0x3e, 0x36, 0x86, 0x05, 0x39, 0x65, 0x30,
+    0x67, 0xa4, 0x86, 0x30, 0x8b, 0xac, 0xed, 0xee, 0xcc, 0x98, 0x58, 0xc2, 0x18, 0xfa, 0x43, 0x64,
+    0xdc, 0x4c, 0xf6, 0xe5, 0x9b, 0xa6, 0xc9, 0xc5, 0x9f, 0x2c, 0x13, 0x94, 0x70, 0x87, 0x66, 0x96,
+    0x42, 0x3b, 0x75, 0x66, 0x74, 0x80, 0x6e, 0x19, 0x77, 0x43, 0x5e, 0x44, 0x23, 0xbf, 0x91, 0xbc,
+    0x61, 0x5c, 0x60, 0x35, 0x80, 0x86, 0x6a, 0x23, 0x6b, 0xbf, 0x6c, 0xae, 0x87, 0x97, 0xb2, 0x01,
+    0x7a, 0x57, 0xc4, 0xb2, 0xd8, 0xf4, 0x22, 0xff, 0x14, 0xdf, 0x89, 0x6f, 0x0d, 0x4c, 0x3c, 0x7a,
+    0x50, 0xea, 0xf0, 0x94, 0x39, 0x3a, 0x73, 0x78, 0xe0, 0xd2, 0x82, 0x3d, 0x86, 0xcb, 0x0b, 0x1e,
+    0x13, 0xd3, 0x61, 0x15, 0x73, 0x53, 0xa6, 0x05, 0x04, 0xd0, 0x73, 0x34, 0x60, 0x2d, 0xa3, 0x0a,
+    0xc8, 0x25, 0xcb, 0xa3, 0x60, 0xc5, 0x0f, 0xca, 0x34, 0x85, 0xcc, 0x99, 0x4b, 0xec, 0xca, 0x96,
+    0x1f, 0x9e, 0x1a, 0x1b, 0xb7, 0x04, 0x1f, 0xe4, 0x08, 0x27, 0x17, 0x06, 0x39, 0x76, 0xf1, 0xe4,
+    0x9c, 0x1f, 0xe0, 0x61, 0xab, 0x74, 0xf5, 0x8a, 0x57, 0xbe, 0x7f, 0x02, 0x08, 0x08, 0xa8, 0x47,
+    0xc7, 0x82, 0x3d, 0x12, 0xd7, 0xe2, 0x13, 0x32, 0x8f, 0xb3, 0x07, 0x85, 0x98, 0xfa, 0xbf, 0x89,
+    0xfb, 0x47, 0xfe, 0x32, 0xee, 0x2e, 0xde, 0xa7, 0xae, 0xec, 0x4f, 0x78, 0xe2, 0xf8, 0x98, 0x57,
+    0x10, 0xd7, 0x60, 0x30, 0x51, 0x08, 0x56, 0x93, 0x39, 0x0f, 0xdf, 0x5a, 0xef, 0xe2, 0xfb, 0xd5,
+    0x60, 0xde, 0x64, 0xc0, 0xbc, 0x31, 0x80, 0x79, 0xa3, 0x07, 0x93, 0x73, 0x3f, 0x68, 0x99, 0x80,
+    0x09, 0xf7, 0x06, 0xad, 0x18, 0x58, 0x37, 0xa6, 0xb4, 0x93, 0xa0, 0x1c, 0xdf, 0xfa, 0xa9, 0x8d,
+    0xeb, 0x67, 0xcf, 0x02, 0x52, 0xa9, 0xe3, 0xab, 0x17, 0xfa, 0x21, 0x78, 0x0f, 0x53, 0x18, 0x38,
+    0xb9, 0x7c, 0x66, 0xaf, 0x5c, 0xed, 0xc4, 0x54, 0x8b, 0xd9, 0x19, 0xfa, 0xa6, 0x66, 0x29, 0x83,
+    0xf5, 0xf9, 0x30, 0x23, 0x6a, 0xc0, 0x83, 0xac, 0x44, 0x3d, 0x1c, 0x25, 0x32, 0xd5, 0x96, 0x06,
+    0xb2, 0xd4, 0x40, 0xfc, 0xbf, 0x70, 0x6d, 0x44, 0xb8, 0x24, 0x18, 0x31, 0x11, 0x67, 0xfe, 0x2a,
+    0xe4, 0x9b, 0x93, 0x34, 0xed, 0x80, 0xe8, 0x2c, 0x4f, 0xb9, 0x4b, 0xbb, 0x76, 0xc5, 0x61, 0xbb,
+    0x19, 0x69, 0x3f, 0x30, 0x5b, 0x41, 0xea, 0x7f, 0x88, 0xe3, 0xb5, 0x25, 0xb0, 0xee, 0x88, 0x0d,
+    0x77, 0xac, 0xaa, 0x2e, 0x4f, 0x59, 0x37, 0xd3, 0xe7, 0x91, 0xec, 0x53, 0xcd, 0x98, 0x67, 0x35,
+    0x9c, 0x99, 0x12, 0xb7, 0x91, 0x5f, 0xe5, 0x98, 0xaa, 0x3a, 0x8d, 0xe0, 0x29, 0x76, 0xf2, 0x23,
+    0x3d, 0x12, 0x18, 0xb6, 0xab, 0xc0, 0xc6, 0x5e, 0x5b, 0xce, 0x91, 0x8d, 0x87, 0x33, 0xb9, 0x21,
+    0x19, 0xcf, 0x30, 0x06, 0xd1, 0xae, 0xa1, 0x79, 0x0a, 0x93, 0xf5, 0x29, 0x55, 0xc9, 0x73, 0x70,
+    0x03, 0x6a, 0x99, 0x2b, 0x65, 0x6f, 0xd7, 0x6c, 0xaf, 0xc4, 0x1e, 0x6f, 0x0d, 0x4c, 0x72, 0x9b,
+    0x40, 0xa4, 0x5f, 0x1e, 0x94, 0x70, 0xb0, 0xca, 0xa3, 0xa5, 0xec, 0x02, 0x70, 0x8c, 0x11, 0x4f,
+    0x8a, 0x49, 0x1e, 0xd2, 0x5f, 0xc5, 0x20, 0x7c, 0x81, 0x7d, 0xa6, 0xfe, 0x95, 0x07, 0xbe, 0x65,
+    0xc6, 0x86, 0x6b, 0x78, 0x99, 0x44, 0xbe, 0x06, 0x20, 0x98, 0x30, 0x48, 0x80, 0xa0, 0x86, 0xbe,
+    0x03, 0x8c, 0xd5, 0x32, 0x81, 0x00, 0x13, 0x63, 0x20, 0xf3, 0x35, 0x6a, 0x9c, 0x35, 0xc9, 0x24,
+    0x2d, 0x45, 0x52, 0x76, 0x1f, 0x3a, 0x09, 0xca, 0x3d, 0xe9, 0x14, 0xfa, 0xd2, 0x9b, 0x2a, 0x84,
+    0xae, 0x93, 0x16, 0xd7, 0x3a, 0x70, 0x2f, 0xa6, 0x71, 0xb4, 0xa4, 0x48, 0x73, 0x78, 0xe5, 0x44,
+    0x32, 0xf3, 0xf0, 0x62, 0xda, 0xd6, 0xe6, 0x1d, 0x41, 0x6a, 0x32, 0x3e, 0xfe, 0x7e, 0x75, 0x7a,
+    0x6c, 0xbc, 0x5c, 0x50, 0x6a, 0x2c, 0xe3, 0x4b, 0x97, 0x46, 0x6a, 0xf8, 0x3a, 0xda, 0x87, 0x03,
+    0xc3, 0xc8, 0x8a, 0x5b, 0x5f, 0x67, 0xf8, 0xa4, 0x07, 0x61, 0x71, 0x99, 0xf3, 0x98, 0xfb, 0x77,
+    0x42, 0x42, 0xf5, 0xe1, 0x6b, 0x60, 0x91, 0x54, 0xde, 0x69, 0x90, 0x18, 0xac, 0x81, 0xc4, 0x6d,
+    0xe9, 0x64, 0x67, 0xb7, 0x12, 0xb4, 0x99, 0x29, 0xf9, 0xb1, 0xb1, 0x51, 0xe9, 0x7e, 0x87, 0x38,
+    0xe1, 0x40, 0x0d, 0x62, 0x45, 0x57, 0x19, 0x70, 0xa6, 0xc7, 0xef, 0x60, 0x48, 0x13, 0x7f, 0x5e,
+    0xa4, 0xad, 0xc4, 0x42, 0x10, 0x96, 0xbe, 0x76, 0x16, 0xdc, 0x5f, 0x45, 0x2d, 0x53, 0xce, 0xb1,
+    0x0a, 0x6a, 0x5f, 0x85, 0x79, 0xdb, 0xa1, 0xd0, 0xab, 0x2a, 0x59, 0x57, 0xdc, 0x4e, 0x52, 0xcf,
+    0xaa, 0x29, 0xc9, 0xcd, 0xe5, 0x36, 0x7e, 0x8b, 0xd9, 0x78, 0x25, 0xb5, 0x5c, 0x91, 0xc8, 0xd6,
+    0x0f, 0xd4, 0x7a, 0x2f, 0x32, 0xe5, 0x84, 0xdb, 0xa8, 0xf1, 0xab, 0x8f, 0x74, 0x71, 0xdb, 0x78,
+    0xf7, 0xbe, 0x5d, 0x2f, 0x6b, 0xad, 0x64, 0xa0, 0x09, 0x61, 0x92, 0x2d, 0x41, 0x6d, 0x39, 0x7f,
+    0x34, 0x59, 0x54, 0x83, 0xc0, 0xa8, 0xbb, 0x9e, 0x86, 0x2d, 0xfd, 0xa4, 0x64, 0x0c, 0xd8, 0x25,
+    0x85, 0x3b, 0x70, 0x16, 0xaa, 0x95, 0x25, 0x67, 0x9b, 0x36, 0x19, 0x35, 0x92, 0x00, 0x80, 0x20,
+    0x1c, 0x6c, 0xbe, 0x72, 0xf1, 0x5c, 0x1c, 0x46, 0xee, 0x1b, 0xb3, 0x93, 0x7d, 0x2e, 0xec, 0xf5,
+    0x50, 0x97, 0x57, 0x89, 0x9d, 0xf2, 0x12, 0xfb, 0x29, 0x45, 0x5f, 0x7c, 0x15, 0x60, 0xc4, 0xde,
+    0xbe, 0x53, 0xcf, 0xf5, 0x09, 0x58, 0x8b, 0xca, 0xb3, 0x28, 0x91, 0x0a, 0xff, 0x3d, 0x65, 0xbb,
+    0xf0, 0xdf, 0xa3, 0x47, 0x5a, 0x05, 0x28, 0xb6, 0xc8, 0x97, 0xab, 0x10, 0xd4, 0xa4, 0x81, 0x2b,
+    0xef, 0xa9, 0x11, 0xcc, 0xe9, 0xed, 0x7b, 0xc9, 0x8e, 0x76, 0x29, 0x82, 0x72, 0x8f, 0x23, 0xf2,
+    0x99, 0xeb, 0x83, 0xd4, 0xa7, 0x55, 0x5c, 0x76, 0x10, 0xd8, 0x37, 0x0f, 0xb4, 0x4e, 0x56, 0x5c,
+    0x8c, 0x37, 0x8a, 0xcb, 0x53, 0xf0, 0xdf, 0xb4, 0x2e, 0x45, 0xfc, 0x7f, 0x7b, 0xa0, 0xaf, 0xb1,
+    0x20, 0xec, 0x53, 0x20, 0x9a, 0x0c, 0xfa, 0x0f, 0x7c, 0xbc, 0x72, 0xdc, 0xa4, 0xce, 0x8c, 0x8e,
+    0x24, 0x43, 0x04, 0xe9, 0x80, 0x39, 0xe8, 0x19, 0x3f, 0xc8, 0xcf, 0xaf, 0xb6, 0x26, 0xe5, 0x81,
+    0x2e, 0xe7, 0x00, 0xa0, 0xc4, 0x81, 0x3d, 0xe6, 0x6a, 0x92, 0xb8, 0x88, 0x4e, 0xbb, 0x45, 0x2e,
+    0xe9, 0x35, 0x4c, 0x4f, 0x4c, 0x3f, 0x38, 0xb5, 0xcb, 0x78, 0xe7, 0x29, 0xe0, 0x54, 0xcc, 0xd8,
+    0x6a, 0x7e, 0x01, 0xd6, 0xb4, 0x09, 0xcb, 0x34, 0x3f, 0x23, 0x0a, 0x9e, 0xb9, 0xe5, 0x95, 0xdb,
+    0xff, 0xa0, 0x45, 0xf6, 0x9b, 0xf3, 0xef, 0xbf, 0x03, 0xa5, 0x15, 0x80, 0xbb, 0xe7, 0xcc, 0x6e,
+    0x5a, 0x19, 0x8c, 0xdb, 0xba, 0x3d, 0x5b, 0xd7, 0x0f, 0xe3, 0x23, 0x10, 0xb1, 0x80, 0x1a, 0x34,
+    0x9e, 0x1d, 0xa0, 0xdc, 0x2d, 0xee, 0xb0, 0x71, 0xbb, 0xde, 0xfe, 0xcb, 0xda, 0x0b, 0x17, 0x55,
+    0x6f, 0x53, 0x37, 0x69, 0xa8, 0xb7, 0xf0, 0x7c, 0xef, 0xec, 0xec, 0xb3, 0x96, 0x13, 0x35, 0x43,
+    0xe6, 0x81, 0x4c, 0xe0, 0x13, 0xc0, 0x28, 0x62, 0xbe, 0xc7, 0xdb, 0xa5, 0x22, 0xfb, 0x42, 0x96,
+    0xc0, 0x24, 0xd2, 0xe8, 0x72, 0xef, 0x02, 0x62, 0xdb, 0xae, 0x7a, 0xce, 0x57, 0x5e, 0x8b, 0x2b,
+    0x00, 0x0c, 0x5f, 0xb2, 0x02, 0x66, 0x8b, 0x59, 0xc3, 0xc5, 0xc3, 0x61, 0x6c, 0xe8, 0x12, 0x4e,
+    0xf8, 0x74, 0x1f, 0x74, 0x09, 0x98, 0xa3, 0x08, 0xfd, 0xf3, 0x09, 0x39, 0x42, 0x53, 0xf8, 0xfd,
+    0x92, 0x07, 0x98, 0xdb, 0x04, 0x1b, 0x15, 0xb2, 0x31, 0x87, 0x09, 0xa1, 0x13, 0xcc, 0xb3, 0xd0,
+    0x3c, 0xfc, 0x98, 0xdb, 0xcc, 0x85, 0xf5, 0x02, 0x84, 0xb9, 0x37, 0x24, 0x17, 0x21, 0x73, 0xa2,
+    0x90, 0xe1, 0xe1, 0x16, 0x71, 0x36, 0xb7, 0x43, 0xd3, 0x8a, 0xe0, 0x6e, 0xe8, 0x25, 0x74, 0x86,
+    0x45, 0x12, 0xf8, 0xff, 0x85, 0x9f, 0x29, 0xd1, 0x04, 0x70, 0x60, 0x0a, 0x99, 0x1d, 0x22, 0x8f,
+    0xd8, 0xd8, 0x06, 0x4f, 0x8b, 0xd8, 0x26, 0x16, 0x02, 0xb3, 0x97, 0x4b, 0x08, 0x5f, 0x01, 0xb8,
+    0x87, 0xb8, 0x3a, 0x14, 0xe0, 0xd0, 0x69, 0x56, 0x3d, 0xa5, 0xc8, 0xf3, 0xf8, 0xfb, 0xb3, 0xb3,
+    0x67, 0xdf, 0x9d, 0xfc, 0xee, 0xf4, 0xe5, 0x8f, 0xe7, 0xdf, 0xfe, 0xee, 0xec, 0x1c, 0x78, 0xb9,
+    0x9d, 0x09, 0x32, 0x45, 0xa3, 0xb3, 0x67, 0x3f, 0xfd, 0xee, 0xe8, 0xd9, 0xeb, 0xe3, 0x6f, 0x7f,
+    0x27, 0x9b, 0x63, 0xb3, 0xfe, 0x8e, 0xda, 0x4c, 0x22, 0x9a, 0x30, 0x6d, 0x44, 0xd3, 0x7b, 0x96,
+    0xaf, 0x45, 0xa0, 0xad, 0x24, 0xd1, 0xe2, 0x9c, 0x83, 0x19, 0xf3, 0x26, 0xca, 0x9e, 0x53, 0xa6,
+    0x01, 0x1a, 0xfc, 0xa0, 0x10, 0xd9, 0x64, 0x1a, 0xbc, 0xf0, 0x4e, 0x5d, 0xca, 0x45, 0x24, 0x61,
+    0x92, 0xce, 0x7e, 0xa7, 0xab, 0x4f, 0x76, 0xd3, 0x94, 0x72, 0x34, 0x50, 0x05, 0x8c, 0xc4, 0x0b,
+    0x13, 0x4c, 0x2e, 0xef, 0x10, 0x6d, 0x86, 0x64, 0x3e, 0x3d, 0x39, 0x00, 0x46, 0x07, 0x62, 0xab,
+    0x1b, 0x0f, 0xac, 0x6b, 0x81, 0x7f, 0xd3, 0xa6, 0x6d, 0xee, 0x0b, 0x1f, 0x67, 0x43, 0x23, 0xa9,
+    0x40, 0xa1, 0xd8, 0xbe, 0x93, 0x23, 0x8b, 0x9a, 0xad, 0xef, 0x67, 0xad, 0xe6, 0xa8, 0xe0, 0x13,
+    0x51, 0x87, 0x0f, 0x1c, 0xf3, 0xf8, 0xb2, 0xdb, 0x21, 0xd5, 0x86, 0xc5, 0x5d, 0xc3, 0xd5, 0x58,
+    0x68, 0x09, 0x0c, 0xad, 0x45, 0x8b, 0x36, 0x96, 0x8b, 0x7d, 0x41, 0xf5, 0x64, 0x0a, 0x4f, 0xc1,
+    0xe0, 0x28, 0xfa, 0x3a, 0x3f, 0x39, 0x3d, 0x08, 0xbf, 0x39, 0xac, 0x04, 0x18, 0xaf, 0xa2, 0x21,
+    0x48, 0x3a, 0xb6, 0xea, 0xc4, 0x78, 0xa8, 0xbe, 0x03, 0x04, 0x15, 0xd3, 0x95, 0xcb, 0x65, 0xfb,
+    0x53, 0x14, 0xef, 0xca, 0xfd, 0x4f, 0x6d, 0x1f, 0x65, 0x52, 0xd0, 0xc0, 0xe7, 0xe5, 0x60, 0x24,
+    0x24, 0x81, 0x7d, 0xf5, 0x15, 0x7b, 0xa8, 0x08, 0x80, 0xde, 0xba, 0xe6, 0x84, 0x28, 0xe3, 0x40,
+    0xd2, 0x1a, 0x8c, 0x09, 0xec, 0x14, 0xd6, 0x40, 0x7b, 0x1d, 0x37, 0x39, 0x07, 0x4b, 0xe3, 0xf8,
+    0x94, 0x08, 0x72, 0x4c, 0x65, 0x81, 0xe3, 0x18, 0x96, 0x53, 0x65, 0xa0, 0x21, 0x4f, 0x28, 0x65,
+    0xcb, 0x03, 0x69, 0xe0, 0x46, 0x2f, 0x24, 0x6d, 0x74, 0x83, 0xdb, 0x87, 0xca, 0x20, 0x3a, 0x86,
+    0x21, 0x2e, 0x12, 0x68, 0xac, 0x47, 0x11, 0x8b, 0xe2, 0xea, 0x6f, 0x9b, 0x42, 0x9a, 0xb8, 0x37,
+    0xf9, 0x04, 0x34, 0xb4, 0x91, 0x97, 0xd9, 0xe6, 0x49, 0x99, 0xe6, 0x5b, 0x10, 0xb4, 0x77, 0xe4,
+    0xdd, 0x97, 0x88, 0xab, 0x76, 0xdd, 0x08, 0x0d, 0x38, 0x4a, 0x40, 0xa2, 0xb1, 0x6e, 0xbd, 0x4d,
+    0x84, 0x56, 0x00, 0x4d, 0x25, 0x58, 0x37, 0x49, 0x19, 0x65, 0x52, 0xdc, 0x22, 0x98, 0x71, 0x8c,
+    0x65, 0x9b, 0x8f, 0x65, 0x5b, 0x30, 0xfb, 0x9a, 0x03, 0x9f, 0x79, 0x34, 0xf7, 0xc1, 0x3a, 0x34,
+    0x5f, 0x7d, 0x7f, 0xfe, 0xba, 0xd9, 0xd1, 0x1c, 0xb1, 0x8c, 0xef, 0x03, 0x81, 0x43, 0xf1, 0x91,
+    0x35, 0xe5, 0xee, 0x4b, 0xf7, 0xf5, 0xcd, 0x92, 0x37, 0xa1, 0x0b, 0x29, 0xec, 0x09, 0x6d, 0xf0,
+    0x3e, 0xfe, 0x7d, 0xe8, 0x7b, 0x4d, 0x76, 0x5b, 0x04, 0x80, 0x87, 0x15, 0xee, 0xab, 0xfe, 0xc2,
+    0xc7, 0x18, 0x7f, 0x00, 0x2c, 0xb8, 0x70, 0xab, 0xb8, 0x23, 0xed, 0x1e, 0x58, 0x06, 0xaf, 0x15,
+    0x88, 0xd3, 0xae, 0xb9, 0x3e, 0x78, 0xc2, 0xc9, 0x8f, 0x5b, 0x00, 0x74, 0x2c, 0xe7, 0xa5, 0xd9,
+    0xdf, 0xb6, 0x86, 0x6d, 0x73, 0xf1, 0xcf, 0x89, 0x30, 0x37, 0xa0, 0x73, 0xc0, 0xda, 0xcf, 0x40,
+    0xba, 0xf1, 0x64, 0x59, 0x94, 0xb8, 0xab, 0x39, 0x98, 0x34, 0x3c, 0xab, 0x71, 0x6e, 0xa3, 0x4d,
+    0x87, 0x09, 0xe2, 0x1c, 0x16, 0xfe, 0x6a, 0x09, 0x0c, 0xe0, 0x53, 0x3e, 0xed, 0x98, 0x20, 0xda,
+    0xc8, 0x25, 0x14, 0x58, 0xdb, 0x93, 0xf6, 0x8f, 0x80, 0x4f, 0xd1, 0x8a, 0x4d, 0xc0, 0x38, 0x86,
+    0x3e, 0xd9, 0x39, 0x3a, 0x81, 0x93, 0x85, 0x11, 0x9e, 0x10, 0x85, 0xa1, 0x70, 0x58, 0x9a, 0x48,
+    0x47, 0x8c, 0x52, 0xd9, 0x98, 0x39, 0x2e, 0x04, 0x04, 0x59, 0x69, 0x7b, 0xa8, 0x8a, 0x1b, 0x60,
+    0xad, 0x93, 0xb5, 0x3c, 0x5c, 0x81, 0xd8, 0xb9, 0x23, 0x4c, 0xd8, 0x33, 0xf4, 0xaf, 0x7b, 0x58,
+    0xf9, 0xa4, 0x2e, 0x68, 0x03, 0x10, 0x75, 0x4c, 0xf2, 0xe4, 0x4c, 0x39, 0xfd, 0xcc, 0x92, 0x7e,
+    0x9b, 0xd5, 0xc6, 0xef, 0xa8, 0x34, 0x00, 0x09, 0xc4, 0x2f, 0x8b, 0x80, 0x00, 0xb5, 0x32, 0x58,
+    0xb5, 0xcb, 0x36, 0x04, 0xd7, 0xd4, 0xf3, 0xfa, 0x15, 0xac, 0xec, 0x4e, 0x3e, 0x4c, 0x24, 0xc8,
+    0xff, 0x50, 0x56, 0x68, 0xe0, 0x43, 0x80, 0xce, 0x83, 0x00, 0xb7, 0xa7, 0xe5, 0xf8, 0x52, 0x74,
+    0x03, 0xfe, 0x7b, 0x70, 0xd3, 0xc0, 0xc5, 0x82, 0x05, 0xa6, 0x48, 0x63, 0x47, 0x34, 0xd1, 0x26,
+    0x5b, 0x15, 0x71, 0x9f, 0x60, 0xc3, 0x16, 0x0c, 0x20, 0x16, 0xbd, 0x76, 0xbc, 0x99, 0xed, 0xb8,
+    0x62, 0x1c, 0x78, 0xa0, 0x38, 0xf0, 0x8c, 0x81, 0x8c, 0x78, 0x60, 0xd8, 0x6f, 0x5a, 0xe6, 0xe2,
+    0x37, 0xa3, 0x0b, 0xa2, 0xc9, 0xde, 0x54, 0xd8, 0xc8, 0xd2, 0xec, 0x1b, 0xac, 0x89, 0x23, 0x40,
+    0x06, 0x24, 0x58, 0xae, 0x4a, 0x71, 0xde, 0x3c, 0x95, 0xd8, 0x3d, 0x16, 0xb7, 0x7a, 0x63, 0xf0,
+    0xf3, 0x5a, 0xae, 0x7d, 0x83, 0x2e, 0x21, 0x5c, 0x8a, 0x6a, 0xfc, 0x53, 0xf2, 0xf7, 0xe6, 0xed,
+    0xa2, 0xcd, 0x9a, 0xf2, 0x89, 0x3f, 0xe5, 0x99, 0x56, 0xad, 0xf1, 0x6a, 0x36, 0xe3, 0x81, 0x3e,
+    0x6c, 0x97, 0xd5, 0xe3, 0xe8, 0xcb, 0x61, 0x50, 0xf2, 0x5b, 0xf8, 0x35, 0x6e, 0x5f, 0xb4, 0x65,
+    0xe2, 0x41, 0x6f, 0x7c, 0x13, 0xf1, 0x97, 0xc2, 0x84, 0x3c, 0x05, 0x4f, 0x11, 0x77, 0x6c, 0xa8,
+    0x6a, 0x1a, 0x22, 0x87, 0x1f, 0x1d, 0x2f, 0xda, 0x6b, 0x81, 0x69, 0xc3, 0xfd, 0x30, 0xeb, 0x7a,
+    0x6b, 0x58, 0x7c, 0xd8, 0x8f, 0x1f, 0x6e, 0x6f, 0xe9, 0xa4, 0x28, 0x9a, 0x07, 0x32, 0x70, 0x7c,
+    0x2e, 0xe6, 0x14, 0xf5, 0x8b, 0x9d, 0x63, 0x4f, 0xb3, 0xd4, 0xee, 0x20, 0xa2, 0xf9, 0x11, 0x07,
+    0x62, 0xc4, 0x7e, 0xad, 0xe1, 0x56, 0x1e, 0xe8, 0xb1, 0xa5, 0x1f, 0xe0, 0x81, 0x74, 0xb9, 0x39,
+    0x91, 0x27, 0x9f, 0x32, 0x4a, 0xcb, 0x29, 0xf0, 0xdb, 0x35, 0xd2, 0x0a, 0x33, 0xd7, 0xbe, 0x40,
+    0x7b, 0x9e, 0xef, 0x3b, 0xd4, 0x1a, 0xbc, 0x89, 0xbf, 0xa2, 0xcd, 0xfb, 0x7c, 0xdb, 0x27, 0xda,
+    0xb6, 0x20, 0xe8, 0x3a, 0x37, 0x41, 0x6a, 0xc7, 0x8b, 0x71, 0xcd, 0x44, 0x06, 0x0d, 0x69, 0x4c,
+    0x66, 0xe0, 0x20, 0xc2, 0xf0, 0x2b, 0x93, 0xb9, 0x83, 0x89, 0x24, 0xac, 0x8b, 0xca, 0xe7, 0xda,
+    0x94, 0x62, 0x9a, 0x88, 0x42, 0x0a, 0xac, 0x7a, 0x24, 0xc2, 0xa0, 0x0b, 0xfb, 0x9a, 0x0d, 0x35,
+    0x39, 0x9a, 0x8b, 0xb1, 0x18, 0xe5, 0x3d, 0x5c, 0xb5, 0x7e, 0xf5, 0x31, 0x3f, 0x98, 0x1d, 0xb5,
+    0x6f, 0x3b, 0xac, 0x78, 0x17, 0xe0, 0xf5, 0x8d, 0x4f, 0x06, 0xed, 0xdb, 0xf6, 0xfb, 0xf2, 0xf9,
+    0x91, 0xf5, 0x4c, 0x1a, 0x9b, 0x0f, 0x0b, 0x69, 0x9f, 0xb5, 0xc4, 0xcc, 0x7d, 0x05, 0x22, 0x6b,
+    0x81, 0x0c, 0x7d, 0xc3, 0x64, 0xf5, 0x30, 0xbd, 0xce, 0x41, 0x09, 0x6e, 0x8d, 0x3b, 0x30, 0xe6,
+    0x76, 0x94, 0xef, 0x2a, 0xa5, 0xd0, 0xd2, 0xb4, 0x5d, 0x2e, 0xf6, 0x73, 0x53, 0xdd, 0xdf, 0xc1,
+    0xaf, 0xfd, 0xa2, 0x9f, 0xd2, 0xd6, 0xb4, 0x16, 0xe7, 0xfa, 0xbe, 0xe2, 0xc1, 0x84, 0x3e, 0x03,
+    0x90, 0xa7, 0x79, 0x47, 0xd3, 0x43, 0x6e, 0xf2, 0xc8, 0xa0, 0x58, 0xed, 0xb1, 0x5b, 0xd6, 0x83,
+    0xca, 0x52, 0xd5, 0x1e, 0x7b, 0x9a, 0x1e, 0x78, 0x34, 0xc9, 0x33, 0xf1, 0xe6, 0x7c, 0xdc, 0xf8,
+    0x05, 0x11, 0xd2, 0xb7, 0x24, 0x25, 0x42, 0x46, 0x8a, 0x3d, 0xed, 0xc9, 0x84, 0xbb, 0x6f, 0x0a,
+    0xdd, 0x06, 0x75, 0xba, 0xfd, 0x5c, 0xe8, 0xb6, 0x55, 0xd1, 0x0d, 0x05, 0x79, 0x9f, 0xfe, 0xed,
+    0xe8, 0xa4, 0x8f, 0xbe, 0xdf, 0xa0, 0xe6, 0x7b, 0x4a, 0x23, 0x04, 0x74, 0x1d, 0xb3, 0xca, 0x56,
+    0x5d, 0x3d, 0x52, 0xb8, 0x62, 0x17, 0x33, 0xd5, 0xe9, 0xcd, 0x76, 0x01, 0x81, 0xa2, 0x2b, 0x97,
+    0x98, 0x49, 0x4a, 0xf0, 0x1d, 0x91, 0xfe, 0x6d, 0xb5, 0x4d, 0x3d, 0x85, 0x7e, 0x2e, 0x79, 0x0f,
+    0x27, 0xf7, 0xd2, 0xa9, 0xd1, 0x50, 0x1c, 0x94, 0xec, 0xbb, 0xfe, 0xf8, 0xa2, 0x55, 0x51, 0xa5,
+    0x9c, 0xb7, 0x6e, 0xaf, 0xd3, 0xb4, 0x05, 0x2e, 0x6c, 0xac, 0x76, 0xc4, 0xec, 0x08, 0x7a, 0x90,
+    0x71, 0x7a, 0xe5, 0x00, 0x7c, 0xeb, 0xe0, 0x02, 0x7c, 0x0c, 0x34, 0x6f, 0x91, 0x9f, 0x26, 0x88,
+    0x90, 0x57, 0x5c, 0x13, 0x60, 0x16, 0xdf, 0x49, 0x53, 0x0f, 0x83, 0x2f, 0x4c, 0x4a, 0xa9, 0xd7,
+    0x70, 0x9e, 0x33, 0xbd, 0x79, 0xd7, 0x41, 0x93, 0x97, 0xbe, 0x82, 0x30, 0xdf, 0xbf, 0xea, 0xd1,
+    0x0e, 0xdc, 0xb9, 0xbf, 0x82, 0x65, 0xa8, 0xd3, 0x98, 0x84, 0xe5, 0x2b, 0xdf, 0x75, 0x31, 0xa6,
+    0xbf, 0x4f, 0x3a, 0x5a, 0x6c, 0x49, 0x4a, 0x1b, 0x9d, 0x19, 0x14, 0x84, 0x49, 0x3c, 0x52, 0xcd,
+    0xa1, 0xb8, 0xab, 0xd9, 0x24, 0x14, 0xb2, 0x87, 0x94, 0x95, 0xbd, 0x22, 0x27, 0xe6, 0x19, 0xc6,
+    0xa3, 0x50, 0x84, 0xea, 0x6f, 0x5b, 0x9c, 0xea, 0x6e, 0x35, 0x54, 0x60, 0xc2, 0xcf, 0xb3, 0x97,
+    0xe1, 0xdc, 0x4f, 0xf2, 0xe6, 0x1e, 0x26, 0xa7, 0x61, 0x5e, 0x03, 0xb6, 0x20, 0xaf, 0xcf, 0x47,
+    0x0f, 0x9a, 0xe6, 0x14, 0x10, 0x73, 0x43, 0x86, 0x29, 0x48, 0x6d, 0x80, 0x22, 0x06, 0xee, 0xe1,
+    0xda, 0xa4, 0x12, 0x07, 0x08, 0x09, 0xb3, 0x12, 0xdb, 0x83, 0x95, 0x59, 0x44, 0xe0, 0xfb, 0x31,
+    0xfa, 0x94, 0x3d, 0x3b, 0x0c, 0x9d, 0x0b, 0xaf, 0x95, 0x69, 0xde, 0x91, 0x84, 0x68, 0x90, 0x36,
+    0x49, 0xb2, 0x5a, 0x6b, 0x0f, 0xc4, 0x65, 0xf8, 0x8d, 0xe5, 0x31, 0xbe, 0xe7, 0xc1, 0x68, 0x21,
+    0x9e, 0x54, 0xeb, 0x44, 0x21, 0x77, 0x67, 0x07, 0xd9, 0xbc, 0x1c, 0xbe, 0x09, 0x42, 0xf9, 0x44,
+    0x0a, 0x96, 0x58, 0x28, 0x19, 0xa3, 0x9b, 0x1c, 0xdf, 0x23, 0xd9, 0xc3, 0x22, 0xe3, 0xb6, 0x59,
+    0x22, 0x43, 0x12, 0x6f, 0x51, 0x9f, 0x1e, 0xac, 0x96, 0xe0, 0x92, 0x74, 0x52, 0x2c, 0x40, 0xae,
+    0x7a, 0xbd, 0x5e, 0xd3, 0xb8, 0xf2, 0x4e, 0xc1, 0xc5, 0xc5, 0x97, 0xdf, 0xc8, 0xda, 0x8f, 0xc1,
+    0xcb, 0x09, 0xf1, 0xb0, 0x38, 0x3c, 0xa4, 0x19, 0x1d, 0xc9, 0x0c, 0x61, 0x86, 0x15, 0x96, 0xc8,
+    0xae, 0xba, 0xf3, 0x4b, 0xba, 0x96, 0x07, 0x97, 0xb6, 0x6b, 0x74, 0xa0, 0xef, 0xb6, 0x00, 0x97,
+    0x30, 0x62, 0xf9, 0xfa, 0x8b, 0xf7, 0xf4, 0x48, 0xee, 0x70, 0xb5, 0x06, 0x28, 0xaa, 0x10, 0x84,
+    0xe2, 0x2c, 0xc8, 0xe5, 0x40, 0x7a, 0x06, 0xec, 0xd1, 0xe4, 0x43, 0xa9, 0xe2, 0x4e, 0x85, 0x40,
+    0x93, 0x9a, 0x7a, 0x98, 0x11, 0x24, 0x43, 0x9a, 0x26, 0xad, 0x86, 0x3d, 0x7a, 0x75, 0x56, 0x2f,
+    0x93, 0x9e, 0x9e, 0xd5, 0xde, 0x6c, 0xeb, 0xab, 0x34, 0x49, 0xce, 0xa1, 0x99, 0xac, 0x8e, 0x37,
+    0x0c, 0x28, 0x3d, 0x00, 0x7d, 0xa2, 0x84, 0x3e, 0x2f, 0xa0, 0x00, 0xcc, 0x79, 0x0c, 0x08, 0x7b,
+    0x77, 0xbb, 0x66, 0xf2, 0x3f, 0xf3, 0x11, 0x01, 0xc0, 0x59, 0x6c, 0xbe, 0x8a, 0x02, 0xb3, 0x51,
+    0x32, 0x98, 0xac, 0x6d, 0x35, 0x20, 0x8b, 0x3e, 0x94, 0x06, 0x53, 0x27, 0x94, 0xaf, 0x6e, 0xe5,
+    0x51, 0xa5, 0x17, 0xb9, 0xa8, 0xfc, 0x55, 0xfa, 0x58, 0x3a, 0xa7, 0x36, 0x77, 0x04, 0x78, 0xd9,
+    0x9e, 0x63, 0xae, 0xa1, 0xaa, 0x26, 0x73, 0x0f, 0x7b, 0x0e, 0xac, 0xa9, 0xe0, 0xdb, 0xd7, 0x67,
+    0x2f, 0xf1, 0x95, 0xdb, 0x18, 0xb7, 0x6f, 0x0a, 0x82, 0xdd, 0xac, 0x3c, 0x5e, 0xbc, 0xc6, 0x69,
+    0xe2, 0xe0, 0x38, 0xae, 0x01, 0xf8, 0x1f, 0xfe, 0xab, 0x14, 0x70, 0xe6, 0xd0, 0x2d, 0xf3, 0x24,
+    0xbc, 0x7c, 0x7e, 0x42, 0x2f, 0x43, 0x09, 0x8d, 0x2c, 0x19, 0xae, 0xdd, 0x99, 0x4b, 0x62, 0x0a,
+    0x5c, 0x93, 0x94, 0x7f, 0xcc, 0x4e, 0x0f, 0xc5, 0x1a, 0x20, 0x3f, 0xfa, 0x60, 0x03, 0x9e, 0x1e,
+    0xc7, 0x7b, 0xa7, 0xa5, 0x8a, 0x3b, 0x57, 0x9c, 0x96, 0xee, 0x4f, 0xc6, 0xfb, 0x3c, 0x6f, 0xb3,
+    0x9d, 0x95, 0x56, 0xb8, 0x30, 0xde, 0x29, 0x74, 0xae, 0xbb, 0x2f, 0x2b, 0x71, 0x2d, 0x91, 0x9c,
+    0xf7, 0xf0, 0x58, 0xec, 0xca, 0x9a, 0x42, 0x9a, 0xb4, 0x58, 0x04, 0xc0, 0x24, 0xec, 0x7a, 0xeb,
+    0xbc, 0xd3, 0x2d, 0xdd, 0x24, 0x7e, 0x4e, 0x3b, 0x1d, 0xe2, 0xe7, 0x88, 0x4c, 0x59, 0x14, 0xb1,
+    0x09, 0x62, 0x7c, 0x4b, 0x19, 0x41, 0xa5, 0xbc, 0xfe, 0xea, 0xab, 0x94, 0xf1, 0x30, 0x7e, 0x59,
+    0x56, 0x08, 0xb7, 0x8f, 0x27, 0x11, 0x1e, 0xd5, 0x86, 0x1f, 0x67, 0x10, 0x2f, 0x6d, 0x53, 0xaa,
+    0x01, 0xd5, 0xe7, 0x58, 0xe4, 0x21, 0xc8, 0x0b, 0x32, 0x42, 0x90, 0x2f, 0x7a, 0xe7, 0x46, 0xac,
+    0x2c, 0x6b, 0xcf, 0x4f, 0x61, 0x05, 0x82, 0x3f, 0x42, 0xa7, 0x78, 0xd3, 0x50, 0x62, 0x08, 0x7f,
+    0xa3, 0xb9, 0x13, 0x22, 0xd2, 0x25, 0x88, 0x25, 0x5b, 0xf7, 0xf1, 0xb6, 0x21, 0x95, 0x11, 0xcd,
+    0x5c, 0x1f, 0x2c, 0x4c, 0xcb, 0x81, 0x78, 0x60, 0x17, 0x6b, 0x3c, 0xf3, 0xb8, 0xc4, 0xef, 0xb1,
+    0x8b, 0x84, 0xb8, 0xc1, 0xf1, 0xcd, 0xd2, 0xad, 0xed, 0xfe, 0x36, 0x1d, 0xb6, 0x9c, 0x19, 0xa5,
+    0x84, 0x27, 0xf6, 0x1a, 0xd6, 0xe9, 0x7c, 0xc5, 0xbb, 0xe2, 0xb5, 0x0a, 0x02, 0x0d, 0x66, 0xb8,
+    0x82, 0xf0, 0x39, 0xed, 0xc7, 0x62, 0x54, 0xbd, 0xdd, 0xef, 0x6d, 0x55, 0xd3, 0xf1, 0x7e, 0x1e,
+    0xba, 0x10, 0x5f, 0x43, 0x37, 0x30, 0xa9, 0xbb, 0xf8, 0x31, 0xd0, 0x1d, 0xeb, 0xcb, 0xf6, 0xfb,
+    0xb5, 0xde, 0x0a, 0x00, 0x19, 0xb8, 0xcb, 0x3b, 0xf6, 0x99, 0x6e, 0xfe, 0xf5, 0x39, 0x7d, 0xe7,
+    0x1a, 0x11, 0xb2, 0x98, 0x45, 0x9f, 0x90, 0x87, 0x28, 0x9e, 0x3a, 0xdf, 0xbe, 0x37, 0x77, 0xaf,
+    0xfd, 0xb6, 0x66, 0x29, 0xdf, 0xcb, 0xf0, 0x6f, 0xca, 0x4f, 0x6b, 0x35, 0xd7, 0xa1, 0xa1, 0x89,
+    0x1f, 0x93, 0x6a, 0xd6, 0x41, 0x5b, 0xad, 0x04, 0xaa, 0x4c, 0x7b, 0x9a, 0x14, 0x3b, 0x86, 0xdd,
+    0x2c, 0x8c, 0x0f, 0x02, 0x16, 0x5f, 0x3c, 0x64, 0x13, 0xdb, 0x9d, 0xe0, 0x27, 0x15, 0xd4, 0xf7,
+    0xc9, 0xe4, 0xab, 0x49, 0xd0, 0xe5, 0x27, 0x45, 0x43, 0x27, 0xd1, 0xbb, 0xd0, 0x5e, 0xf1, 0x3a,
+    0x5c, 0xd8, 0x8e, 0x97, 0x46, 0xf6, 0x42, 0x55, 0x18, 0x8b, 0x31, 0x44, 0x1c, 0xaf, 0x00, 0x96,
+    0x37, 0x8b, 0x2f, 0xfb, 0x65, 0xfa, 0xfc, 0xac, 0xeb, 0xf3, 0x33, 0xbd, 0xdc, 0x77, 0x20, 0xb6,
+    0x21, 0xa8, 0x12, 0x17, 0xd7, 0x45, 0x9f, 0x94, 0xc1, 0x45, 0x60, 0x63, 0x45, 0x5d, 0xb1, 0x7a,
+    0xc2, 0xf7, 0x2e, 0x79, 0x20, 0xa1, 0x72, 0x40, 0x16, 0x4f, 0x31, 0x16, 0x9b, 0xbb, 0x21, 0x6b,
+    0x75, 0xfb, 0x04, 0xa1, 0x4d, 0xc5, 0x29, 0xc4, 0xb1, 0xe4, 0x53, 0x91, 0xf0, 0xd4, 0xa2, 0x87,
+    0x16, 0x2c, 0x02, 0x0d, 0x9a, 0xa8, 0x4d, 0x5a, 0x2d, 0xc1, 0x38, 0xcc, 0x35, 0x61, 0x75, 0x7c,
+    0x5b, 0xbc, 0xda, 0xa3, 0xa3, 0xea, 0x86, 0x9a, 0x4b, 0xd2, 0x6b, 0xb4, 0xff, 0x25, 0x6d, 0xff,
+    0x73, 0xb1, 0xbd, 0x4a, 0xe5, 0xaf, 0x39, 0x52, 0x48, 0x5a, 0x3c, 0x39, 0x8a, 0x56, 0x7c, 0x4f,
+    0x8e, 0x98, 0xb3, 0xa4, 0xd7, 0xbb, 0x12, 0xd2, 0x54, 0xd5, 0x21, 0x46, 0x14, 0xf4, 0xff, 0xb5,
+    0x74, 0xe4, 0x0c, 0x85, 0x67, 0xcd, 0x9e, 0x7a, 0xe2, 0x6d, 0xb3, 0xfd, 0x4d, 0xcf, 0x9f, 0xcd,
+    0x20, 0x02, 0x10, 0x5d, 0xe3, 0xf7, 0x2f, 0x35, 0x42, 0x86, 0xa7, 0xd4, 0xc6, 0xf0, 0x07, 0x7d,
+    0xad, 0x17, 0x67, 0x5f, 0xbf, 0xc4, 0xd7, 0x16, 0x90, 0xf6, 0x2c, 0x3e, 0xdd, 0x4c, 0x67, 0xe4,
+    0x44, 0xe6, 0x99, 0x9e, 0x27, 0x99, 0x11, 0xfb, 0xa5, 0x05, 0x8b, 0xc9, 0xa9, 0xce, 0xfa, 0xdd,
+    0x79, 0x82, 0x30, 0xa8, 0x05, 0x61, 0x50, 0x02, 0x61, 0x58, 0x0b, 0xc2, 0xb0, 0xf0, 0x9a, 0x1d,
+    0x5a, 0x4a, 0x41, 0x44, 0x5b, 0x12, 0x23, 0x55, 0x8c, 0x2b, 0xb8, 0xa4, 0xad, 0xbd, 0x97, 0x4c,
+    0xec, 0xb0, 0xeb, 0xb6, 0xf6, 0x25, 0xb3, 0x04, 0xe8, 0x40, 0x02, 0x1d, 0xac, 0x03, 0xf4, 0xa6,
+    0x02, 0xe8, 0x50, 0x02, 0x1d, 0xae, 0x03, 0xf4, 0x97, 0x14, 0xa8, 0xfe, 0x84, 0x04, 0xd0, 0x6a,
+    0xc9, 0xd1, 0x1b, 0xf8, 0x5a, 0x21, 0xa6, 0x52, 0x8b, 0xc5, 0x03, 0xd9, 0xf8, 0x06, 0x1a, 0x68,
+    0x0b, 0x05, 0xcd, 0xe7, 0x65, 0x98, 0xf4, 0x69, 0xec, 0x79, 0xe8, 0x4f, 0x66, 0x50, 0x07, 0x56,
+    0x7c, 0x53, 0x4c, 0xef, 0x82, 0x0d, 0x11, 0x07, 0xaf, 0xb5, 0xcb, 0xde, 0x9b, 0xff, 0xd4, 0xa5,
+    0xa4, 0x59, 0x0d, 0x8b, 0x0d, 0xd4, 0xf3, 0x8e, 0xca, 0x2b, 0x4c, 0xcd, 0x24, 0x52, 0xd9, 0xe9,
+    0x81, 0xd6, 0xb7, 0x4d, 0x07, 0x32, 0x39, 0x78, 0x69, 0x8b, 0x35, 0x0c, 0x78, 0xdd, 0x69, 0x2b,
+    0x3b, 0x50, 0xc3, 0x38, 0x6d, 0xa2, 0x53, 0xe5, 0xb4, 0xc5, 0xc5, 0x86, 0xf2, 0x2b, 0x38, 0x23,
+    0xf6, 0xb6, 0x29, 0x3f, 0x14, 0x83, 0x05, 0x82, 0xc9, 0x47, 0x51, 0xf0, 0x17, 0xfa, 0xfc, 0x07,
+    0x5e, 0xc8, 0x8f, 0x5d, 0xd0, 0x25, 0x7d, 0x19, 0x01, 0xaf, 0xf0, 0x3b, 0x06, 0xcd, 0x77, 0x07,
+    0xeb, 0xc8, 0x45, 0xe5, 0x89, 0x1f, 0xf7, 0x13, 0x8c, 0x98, 0x07, 0x55, 0xb2, 0x91, 0x7c, 0x8a,
+    0xe1, 0x57, 0x1f, 0x63, 0x3e, 0xbc, 0x35, 0xb3, 0x94, 0x82, 0xa0, 0x84, 0x47, 0x95, 0x42, 0x23,
+    0x7b, 0x95, 0xcb, 0x8d, 0x6c, 0x74, 0x77, 0xd1, 0x31, 0x14, 0x01, 0x66, 0x2a, 0x2e, 0xaf, 0xe6,
+    0xdc, 0x13, 0xe7, 0x85, 0x60, 0x65, 0x82, 0xbf, 0x8a, 0x42, 0x27, 0x93, 0xbb, 0x58, 0xaf, 0xe8,
+    0xb2, 0xe4, 0x50, 0x0d, 0xae, 0x49, 0x9a, 0x51, 0x75, 0x4e, 0x2f, 0xb2, 0x03, 0x00, 0x9e, 0x21,
+    0x51, 0x5a, 0xde, 0x90, 0x52, 0x19, 0x08, 0xb7, 0xfd, 0xb9, 0x4e, 0xe3, 0x78, 0x90, 0x4d, 0x8a,
+    0x2a, 0x47, 0x4b, 0x22, 0x5d, 0x2c, 0x9c, 0x04, 0x22, 0x41, 0x88, 0x2a, 0x7a, 0xe1, 0x8f, 0x1d,
+    0x70, 0x10, 0x89, 0x81, 0xc9, 0x69, 0x1a, 0xf0, 0x88, 0x3e, 0x09, 0x47, 0x67, 0x55, 0x3c, 0x58,
+    0xf3, 0x45, 0x18, 0x23, 0x97, 0xd2, 0xd7, 0xa7, 0x74, 0xbc, 0xa8, 0x7a, 0x7d, 0x2b, 0x43, 0x57,
+    0x87, 0x7d, 0x84, 0x35, 0x1d, 0xe2, 0x07, 0xe2, 0xf7, 0xc5, 0xee, 0x7e, 0x92, 0x00, 0x7e, 0xfa,
+    0x38, 0x3e, 0xb2, 0xf3, 0xe9, 0x63, 0xf1, 0x0d, 0xd1, 0xa7, 0x8f, 0xe7, 0xd1, 0xc2, 0x3d, 0x7c,
+    0xf0, 0x3f, 0x91, 0xde, 0xc3, 0xd1, 0xd3, 0xa9, 0x00, 0x00,
+  };
+}
+
+#endif // DASHBOARD_ASSET_H
@@ -9,8 +9,6 @@ const char dashboard_html[] PROGMEM = R"rawliteral(
     <meta name="viewport" content="width=device-width, initial-scale=1.0">
     <title>Ctempo v2.0</title>
     <style>
-        @import url('https://fonts.googleapis.com/css2?family=Space+Mono:wght@400;700&display=swap');
-
         * {
             margin: 0;
             padding: 0;
@@ -19,7 +17,7 @@ const char dashboard_html[] PROGMEM = R"rawliteral(
         }
 
         body {
-            font-family: 'Space Mono', monospace;
+            font-family: 'Space Mono', ui-monospace, SFMono-Regular, Menlo, Consolas, monospace;
             background: #f5f5f5;
             color: #333;
             min-height: 100vh;
@@ -808,7 +806,7 @@ const char dashboard_html[] PROGMEM = R"rawliteral(
         // Initialize
         initializePalettes();
         setupEventListeners();
-        startPolling();
+        startStatusStream();
 
         function initializePalettes() {
             const paletteGrid = document.getElementById('paletteGrid');
@@ -1039,24 +1037,137 @@ const char dashboard_html[] PROGMEM = R"rawliteral(
             selectPalette(newPaletteIndex);
         }
 
+        // Commands are coalesced: a setting changed several times before the
+        // next flush only sends its latest value, and everything pending goes
+        // out as one batch the device applies in a single frame.
+        const COMMAND_FLUSH_MS = 50;
+        const MAX_BATCH_COMMANDS = 16;
+        const pendingCommands = new Map();
+        let commandSequence = 0;
+        let commandTimer = null;
+        let commandInFlight = false;
+
         function sendCommand(command) {
+            // "name=value" replaces a pending value; bare actions (tap) all go out
+            const equals = command.indexOf('=');
+            const key = equals > 0 ? command.substring(0, equals) : '#' + (commandSequence++);
+            pendingCommands.delete(key);
+            pendingCommands.set(key, command);
+            scheduleCommandFlush();
+        }
+
+        function scheduleCommandFlush() {
+            if (commandTimer === null && !commandInFlight) {
+                commandTimer = setTimeout(flushCommands, COMMAND_FLUSH_MS);
+            }
+        }
+
+        function flushCommands() {
+            commandTimer = null;
+            if (pendingCommands.size === 0) return;
+
+            const entries = [];
+            for (const entry of pendingCommands) {
+                if (entries.length === MAX_BATCH_COMMANDS) break;
+                entries.push(entry);
+            }
+            entries.forEach(([key]) => pendingCommands.delete(key));
+            const batch = entries.map(([, command]) => command);
+
+            commandInFlight = true;
             fetch('/command', {
                 method: 'POST',
                 headers: { 'Content-Type': 'application/json' },
-                body: JSON.stringify({ command: command })
-            }).catch(err => console.error('Command failed:', err));
+                body: JSON.stringify({ commands: batch })
+            }).then(response => {
+                if (response.status === 503) {
+                    // Device queue full: retry whatever has not been superseded,
+                    // ahead of anything queued since, so the order still holds
+                    const retry = entries.filter(([key]) => !pendingCommands.has(key));
+                    const queuedSince = Array.from(pendingCommands);
+                    pendingCommands.clear();
+                    for (const [key, command] of retry.concat(queuedSince)) {
+                        pendingCommands.set(key, command);
+                    }
+                } else if (!response.ok) {
+                    console.error('Command batch rejected:', response.status, batch);
+                }
+            }).catch(err => console.error('Command failed:', err))
+              .finally(() => {
+                  commandInFlight = false;
+                  scheduleCommandFlush();
+              });
+        }
+
+        // Binary status frame from /status.bin (layout in StatusFrame.h)
+        function decodeStatusFrame(buffer) {
+            const view = new DataView(buffer);
+            if (buffer.byteLength < 16 || view.getUint8(0) !== 0x43 || view.getUint8(1) !== 0x54) {
+                throw new Error('not a status frame');
+            }
+            if (view.getUint8(2) !== 1) {
+                throw new Error('unsupported status frame version ' + view.getUint8(2));
+            }
+
+            const flags = view.getUint8(3);
+            const count = view.getUint8(9);
+            const leds = [];
+            const rgb = [];
+            for (let i = 0; i < count; i++) {
+                leds.push(view.getUint8(16 + i) / 100);
+                const at = 16 + count + i * 3;
+                rgb.push(`rgb(${view.getUint8(at)}, ${view.getUint8(at + 1)}, ${view.getUint8(at + 2)})`);
+            }
+
+            return {
+                mode: (flags & 0x01) ? 'liquid' : 'tempo',
+                beat: (flags & 0x02) !== 0,
+                bpm: view.getUint16(4, true),
+                batteryPercent: view.getUint8(6),
+                currentPalette: view.getUint8(7),
+                currentPattern: view.getUint8(8),
+                tiltAngle: view.getInt16(10, true) / 100,
+                accelY: view.getInt16(12, true) / 100,
+                accelZ: view.getInt16(14, true) / 100,
+                leds: leds,
+                rgb: rgb
+            };
+        }
+
+        function fetchStatusFrame() {
+            return fetch('/status.bin')
+                .then(response => response.arrayBuffer())
+                .then(buffer => {
+                    currentData = decodeStatusFrame(buffer);
+                    updateUI();
+                });
+        }
+
+        // The device pushes only what changed; merge it into the last state
+        function startStatusStream() {
+            fetchStatusFrame().catch(err => console.error('Status frame failed:', err));
+            if (!window.EventSource) {
+                startPolling();
+                return;
+            }
+
+            const events = new EventSource('/events');
+            events.addEventListener('status', e => {
+                const update = JSON.parse(e.data);
+                // Snapshot colors no longer match once the levels move
+                if (update.leds) delete currentData.rgb;
+                Object.assign(currentData, update);
+                updateUI();
+            });
+            // EventSource reconnects by itself; the device resends a full snapshot
+            events.onerror = () => console.error('Status stream interrupted, reconnecting...');
         }
 
+        // Fallback for browsers without EventSource
         function startPolling() {
             setInterval(() => {
-                fetch('/status')
-                    .then(response => response.json())
-                    .then(data => {
-                        currentData = data;
-                        updateUI();
-                    })
-                    .catch(err => console.error('Status poll failed:', err));
-            }, 100); // Faster polling for more responsive LED updates
+                fetchStatusFrame().catch(err => console.error('Status poll failed:', err));
+            }, 100); // Same rate as the /events push tick
         }
 
         function updateUI() {
@@ -1078,6 +1189,7 @@ const char dashboard_html[] PROGMEM = R"rawliteral(
 
             // Update LEDs to match current palette
             const ledStates = currentData.leds || [];
+            const ledColors = currentData.rgb;
             const currentPalette = palettes[currentData.currentPalette || 0];
 
             for (let i = 0; i < 7; i++) {
@@ -1086,7 +1198,10 @@ const char dashboard_html[] PROGMEM = R"rawliteral(
 
                 if (brightness > 0.1) {
                     let color;
-                    if (currentPalette) {
+                    if (ledColors && ledColors[i]) {
+                        // Actual LED color from the binary frame
+                        color = ledColors[i];
+                    } else if (currentPalette) {
                         // Use palette color for this LED
                         const colorIndex = Math.floor((i / 7) * currentPalette.colors.length);
                         color = currentPalette.colors[colorIndex];
@@ -132,7 +132,7 @@ public:
     return currentMode;
   }
 
-  // Update mode state (call every loop)
+  // Update mode state (call every frame)
   void update(unsigned long currentTime) {
     // Placeholder for any periodic mode updates
     // Can add timeout logic here if needed
@@ -0,0 +1,77 @@
+#ifndef DEVICE_SNAPSHOT_H
+#define DEVICE_SNAPSHOT_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <string.h>
+#include <type_traits>
+#include "StatusPublisher.h"
+
+// Device state as the render task left it at the end of a frame
+struct DeviceStateSnapshot {
+  uint32_t frame = 0;                      // Frames published so far
+  unsigned long capturedAt = 0;            // millis() at capture
+  DashboardStatus status;
+};
+
+// One writer, any number of readers, nobody waits on anybody
+// Seqlock: the writer makes the sequence odd, stores the value and makes it
+// even again; a reader copies the value and keeps it only if the sequence was
+// the same even number before and after. The value lives in atomic words, so
+// a copy racing the writer is merely discarded, never undefined. The writer
+// (the render task) never blocks; readers on other tasks retry.
+template <typename T>
+class SeqlockSnapshot {
+  static_assert(std::is_trivially_copyable<T>::value, "SeqlockSnapshot needs a trivially copyable type");
+
+private:
+  static constexpr size_t WORDS = (sizeof(T) + 3) / 4;
+  static constexpr int MAX_READ_ATTEMPTS = 64;
+
+  std::atomic<uint32_t> sequence;
+  std::atomic<uint32_t> words[WORDS];
+  mutable std::atomic<uint32_t> retries;   // Reads that overlapped a publish
+
+public:
+  SeqlockSnapshot() : sequence(0), retries(0) {
+    publish(T());
+  }
+
+  // Writer side (one task only)
+  void publish(const T& value) {
+    uint32_t buffer[WORDS] = {0};
+    memcpy(buffer, &value, sizeof(T));
+
+    uint32_t seq = sequence.load(std::memory_order_relaxed);
+    sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < WORDS; i++) {
+      words[i].store(buffer[i], std::memory_order_relaxed);
+    }
+    sequence.store(seq + 2, std::memory_order_release);
+  }
+
+  // Reader side (any task): false only if every attempt overlapped a publish
+  bool read(T& value) const {
+    uint32_t buffer[WORDS];
+    for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++) {
+      uint32_t before = sequence.load(std::memory_order_acquire);
+      if ((before & 1) == 0) {
+        for (size_t i = 0; i < WORDS; i++) {
+          buffer[i] = words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) == before) {
+          memcpy(&value, buffer, sizeof(T));
+          return true;
+        }
+      }
+      retries.fetch_add(1, std::memory_order_relaxed);
+    }
+    return false;
+  }
+
+  unsigned long getReadRetries() const { return retries.load(std::memory_order_relaxed); }
+};
+
+#endif // DEVICE_SNAPSHOT_H
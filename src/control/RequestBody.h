@@ -0,0 +1,132 @@
+#ifndef REQUEST_BODY_H
+#define REQUEST_BODY_H
+
+#include <Arduino.h>
+#include <string.h>
+#include "../config/Constants.h"
+
+// Collects a POST body that arrives in chunks
+// The async web server hands body data over as (data, len, index, total)
+// pieces that are not NUL-terminated. They are copied into one fixed buffer
+// and the body is handed out once the last piece is in, NUL-terminated so it
+// can be parsed in place. One body is collected at a time; a body longer than
+// the buffer is refused at its first chunk; the rest of a refused body is
+// skipped and keeps reporting the same status, so the caller can answer once
+// the last chunk is in. The last few refusals are remembered per request; a
+// mid-body chunk from a request that is neither collecting nor remembered
+// (refusal since overwritten, or its buffer taken over after the timeout)
+// reports BUSY.
+class RequestBody {
+public:
+  enum Status {
+    PARTIAL,      // More chunks to come
+    COMPLETE,     // Whole body in getData()/getLength()
+    TOO_LARGE,    // Longer than COMMAND_BODY_MAX_BYTES
+    BUSY,         // Another request is mid-body
+    MALFORMED     // Chunk not where the body left off
+  };
+
+private:
+  char buffer[WiFiConfig::COMMAND_BODY_MAX_BYTES + 1];  // + NUL
+  size_t length;
+  size_t expected;
+  const void* owner;                 // Request the buffer belongs to (nullptr = free)
+  unsigned long startTime;
+  // Requests turned away, and why (newest overwrites oldest)
+  static constexpr int REFUSED_SLOTS = 4;
+  struct Refusal {
+    const void* request;
+    Status status;
+  };
+  Refusal refusals[REFUSED_SLOTS];
+  int nextRefusal;
+
+  // Statistics
+  unsigned long bodiesCompleted;
+  unsigned long bodiesRejected;
+
+  Status refuse(const void* request, Status status) {
+    if (owner == request) owner = nullptr;
+    refusals[nextRefusal].request = request;
+    refusals[nextRefusal].status = status;
+    nextRefusal = (nextRefusal + 1) % REFUSED_SLOTS;
+    bodiesRejected++;
+    return status;
+  }
+
+  Refusal* findRefusal(const void* request) {
+    for (int i = 0; i < REFUSED_SLOTS; i++) {
+      if (refusals[i].request == request) return &refusals[i];
+    }
+    return nullptr;
+  }
+
+public:
+  RequestBody()
+    : length(0),
+      expected(0),
+      owner(nullptr),
+      startTime(0),
+      nextRefusal(0),
+      bodiesCompleted(0),
+      bodiesRejected(0) {
+    buffer[0] = '\0';
+    for (int i = 0; i < REFUSED_SLOTS; i++) {
+      refusals[i].request = nullptr;
+      refusals[i].status = MALFORMED;
+    }
+  }
+
+  // Adds one chunk of `request`'s body
+  Status append(const void* request, const uint8_t* data, size_t len, size_t index, size_t total) {
+    if (index == 0) {
+      // A new request may reuse an old one's address
+      if (Refusal* refusal = findRefusal(request)) refusal->request = nullptr;
+
+      // A body left unfinished (client went away) gives way after a timeout
+      if (owner && owner != request &&
+          millis() - startTime < WiFiConfig::COMMAND_BODY_TIMEOUT_MS) {
+        return refuse(request, BUSY);
+      }
+      if (total > WiFiConfig::COMMAND_BODY_MAX_BYTES) {
+        return refuse(request, TOO_LARGE);
+      }
+      owner = request;
+      startTime = millis();
+      length = 0;
+      expected = total;
+    } else if (Refusal* refusal = findRefusal(request)) {
+      return refusal->status;
+    } else if (owner != request) {
+      return refuse(request, BUSY);
+    }
+
+    if (index != length || len > expected - length) {
+      return refuse(request, MALFORMED);
+    }
+
+    memcpy(buffer + length, data, len);
+    length += len;
+    if (length < expected) return PARTIAL;
+
+    buffer[length] = '\0';
+    owner = nullptr;
+    bodiesCompleted++;
+    return COMPLETE;
+  }
+
+  // Is this the body's final chunk (time to answer)?
+  static bool isLastChunk(size_t len, size_t index, size_t total) {
+    return index + len >= total;
+  }
+
+  // Body of the last COMPLETE append; valid (and writable, for in-place
+  // parsing) until the next append
+  char* getData() { return buffer; }
+  size_t getLength() const { return length; }
+
+  unsigned long getBodiesCompleted() const { return bodiesCompleted; }
+  unsigned long getBodiesRejected() const { return bodiesRejected; }
+};
+
+#endif // REQUEST_BODY_H
@@ -0,0 +1,212 @@
+#ifndef STAGE_TIMINGS_H
+#define STAGE_TIMINGS_H
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <string.h>
+#include "../config/Constants.h"
+
+// Latency distribution of one stage, in microseconds
+// Fixed log-linear buckets (four per power of two, exact below 8 us), so
+// recording is a couple of shifts and percentiles come out within one bucket
+// (< 25 %) of the true value, with no allocation and no sorting.
+class LatencyHistogram {
+public:
+  static constexpr int SUB_BUCKETS = 4;
+  static constexpr int BUCKETS = 80;             // Top bucket starts at 2^20 us (~1 s)
+
+private:
+  uint32_t buckets[BUCKETS];
+  uint32_t count;
+  uint64_t total;
+  uint32_t minimum;
+  uint32_t maximum;
+
+public:
+  LatencyHistogram() { reset(); }
+
+  static int bucketOf(uint32_t micros) {
+    if (micros < (uint32_t)SUB_BUCKETS) return (int)micros;
+    int exponent = 31 - __builtin_clz(micros);             // >= 2
+    int sub = (micros >> (exponent - 2)) & (SUB_BUCKETS - 1);
+    int index = (exponent - 1) * SUB_BUCKETS + sub;
+    return index < BUCKETS ? index : BUCKETS - 1;
+  }
+
+  // Largest value that lands in `index`
+  static uint32_t bucketTop(int index) {
+    if (index < SUB_BUCKETS) return (uint32_t)index;
+    int exponent = index / SUB_BUCKETS + 1;
+    uint32_t width = 1UL << (exponent - 2);
+    return ((uint32_t)(SUB_BUCKETS + index % SUB_BUCKETS) << (exponent - 2)) + width - 1;
+  }
+
+  void record(uint32_t micros) {
+    buckets[bucketOf(micros)]++;
+    if (count == 0 || micros < minimum) minimum = micros;
+    if (micros > maximum) maximum = micros;
+    total += micros;
+    count++;
+  }
+
+  void reset() {
+    memset(buckets, 0, sizeof(buckets));
+    count = 0;
+    total = 0;
+    minimum = 0;
+    maximum = 0;
+  }
+
+  // Upper bound of the bucket holding the `fraction` quantile (never above max)
+  uint32_t getPercentile(float fraction) const {
+    if (count == 0) return 0;
+    uint32_t rank = (uint32_t)ceilf(fraction * count);
+    if (rank < 1) rank = 1;
+    uint32_t seen = 0;
+    for (int i = 0; i < BUCKETS; i++) {
+      seen += buckets[i];
+      if (seen >= rank) return min(bucketTop(i), maximum);
+    }
+    return maximum;
+  }
+
+  uint32_t getCount() const { return count; }
+  uint32_t getMin() const { return minimum; }
+  uint32_t getMax() const { return maximum; }
+  uint32_t getAverage() const { return count ? (uint32_t)(total / count) : 0; }
+  uint64_t getTotal() const { return total; }
+};
+
+// Instrumented stages of the sensor, render and network tasks
+enum class Stage : uint8_t {
+  SENSOR_DRAIN,    // mpu.read(): FIFO transfer, includes GESTURES
+  GESTURES,        // gestures.update() for one sample
+  COMMANDS,        // Gestures and queued commands applied at frame start
+  RENDER,          // renderFrame(): animations + LED composition
+  SHOW,            // leds.show(): strip latch
+  FRAME,           // Whole frame, start to snapshot publish
+  STATUS_PUSH,     // Dashboard event push
+  COUNT
+};
+
+inline const char* stageName(Stage stage) {
+  switch (stage) {
+    case Stage::SENSOR_DRAIN: return "sensor_drain";
+    case Stage::GESTURES: return "gestures";
+    case Stage::COMMANDS: return "commands";
+    case Stage::RENDER: return "render";
+    case Stage::SHOW: return "show";
+    case Stage::FRAME: return "frame";
+    case Stage::STATUS_PUSH: return "status_push";
+    default: return "?";
+  }
+}
+
+// Histogram per stage, shown by the `stats` command and GET /metrics
+// Each stage is recorded by one task; readers just copy the counters (display
+// only). With SystemConfig::STAGE_TIMING off, StageTimings and
+// ScopedStageTimer are empty and every call compiles to nothing.
+template <bool Enabled>
+class StageTimingsImpl {
+private:
+  LatencyHistogram stages[(int)Stage::COUNT];
+
+  static void append(char* out, size_t size, size_t& length, const char* format, ...) {
+    if (length >= size) return;
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(out + length, size - length, format, args);
+    va_end(args);
+    length = written < 0 ? size : length + (size_t)written;
+  }
+
+public:
+  static constexpr bool ENABLED = true;
+
+  void record(Stage stage, uint32_t micros) {
+    stages[(int)stage].record(micros);
+  }
+
+  void reset() {
+    for (LatencyHistogram& histogram : stages) histogram.reset();
+  }
+
+  const LatencyHistogram& get(Stage stage) const {
+    return stages[(int)stage];
+  }
+
+  void print() const {
+    Serial.println("⏱️ Stage timings (us): count / min / avg / p99 / max");
+    for (int i = 0; i < (int)Stage::COUNT; i++) {
+      const LatencyHistogram& h = stages[i];
+      Serial.print("  ");
+      Serial.print(stageName((Stage)i));
+      Serial.print(": ");
+      Serial.print((unsigned long)h.getCount());
+      Serial.print(" / ");
+      Serial.print((unsigned long)h.getMin());
+      Serial.print(" / ");
+      Serial.print((unsigned long)h.getAverage());
+      Serial.print(" / ");
+      Serial.print((unsigned long)h.getPercentile(0.99f));
+      Serial.print(" / ");
+      Serial.println((unsigned long)h.getMax());
+    }
+  }
+
+  // Prometheus text format; returns the length (>= size means truncated)
+  size_t formatMetrics(char* out, size_t size) const {
+    size_t length = 0;
+    append(out, size, length, "# TYPE ctenophore_stage_us summary\n");
+    for (int i = 0; i < (int)Stage::COUNT; i++) {
+      const LatencyHistogram& h = stages[i];
+      const char* name = stageName((Stage)i);
+      append(out, size, length, "ctenophore_stage_us{stage=\"%s\",quantile=\"0\"} %lu\n", name, (unsigned long)h.getMin());
+      append(out, size, length, "ctenophore_stage_us{stage=\"%s\",quantile=\"0.99\"} %lu\n", name, (unsigned long)h.getPercentile(0.99f));
+      append(out, size, length, "ctenophore_stage_us{stage=\"%s\",quantile=\"1\"} %lu\n", name, (unsigned long)h.getMax());
+      append(out, size, length, "ctenophore_stage_us_sum{stage=\"%s\"} %llu\n", name, (unsigned long long)h.getTotal());
+      append(out, size, length, "ctenophore_stage_us_count{stage=\"%s\"} %lu\n", name, (unsigned long)h.getCount());
+    }
+    return length;
+  }
+};
+
+template <>
+class StageTimingsImpl<false> {
+public:
+  static constexpr bool ENABLED = false;
+  void record(Stage, uint32_t) {}
+  void reset() {}
+  void print() const { Serial.println("⏱️ Stage timing compiled out (SystemConfig::STAGE_TIMING)"); }
+  size_t formatMetrics(char* out, size_t size) const {
+    return size ? snprintf(out, size, "# stage timing disabled\n") : 0;
+  }
+};
+
+// Records the time from construction to the end of the scope
+template <bool Enabled>
+class ScopedStageTimerImpl {
+private:
+  StageTimingsImpl<true>& timings;
+  Stage stage;
+  unsigned long start;
+
+public:
+  ScopedStageTimerImpl(StageTimingsImpl<true>& stageTimings, Stage timedStage)
+    : timings(stageTimings), stage(timedStage), start(micros()) {}
+
+  ~ScopedStageTimerImpl() {
+    timings.record(stage, micros() - start);
+  }
+};
+
+template <>
+class ScopedStageTimerImpl<false> {
+public:
+  ScopedStageTimerImpl(StageTimingsImpl<false>&, Stage) {}
+};
+
+typedef StageTimingsImpl<SystemConfig::STAGE_TIMING> StageTimings;
+typedef ScopedStageTimerImpl<SystemConfig::STAGE_TIMING> ScopedStageTimer;
+
+#endif // STAGE_TIMINGS_H
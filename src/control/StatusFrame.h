@@ -0,0 +1,85 @@
+#ifndef STATUS_FRAME_H
+#define STATUS_FRAME_H
+
+#include <Arduino.h>
+#include "../config/Constants.h"
+#include "StatusPublisher.h"
+
+// Binary status frame served on /status.bin
+// Fixed layout, little-endian (ESP32 and every browser host), decoded by
+// decodeStatusFrame() in the dashboard:
+//
+//   offset  size  field
+//   0       2     magic "CT"
+//   2       1     version (VERSION)
+//   3       1     flags: bit 0 liquid mode, bit 1 beat active
+//   4       2     bpm
+//   6       1     battery %
+//   7       1     palette index
+//   8       1     pattern index
+//   9       1     LED count (N)
+//   10      2     tiltAngle x 100 (signed)
+//   12      2     accelY x 100 (signed, g)
+//   14      2     accelZ x 100 (signed, g)
+//   16      N     LED brightness, percent
+//   16+N    3N    LED colors, R G B per LED (as composed, before gamma)
+//
+// Fields are only ever appended; anything that changes the meaning of an
+// existing offset bumps VERSION.
+namespace StatusFrame {
+  constexpr uint8_t VERSION = 1;
+  constexpr uint8_t FLAG_LIQUID = 0x01;
+  constexpr uint8_t FLAG_BEAT = 0x02;
+
+  struct __attribute__((packed)) Header {
+    char magic[2];
+    uint8_t version;
+    uint8_t flags;
+    uint16_t bpm;
+    uint8_t batteryPercent;
+    uint8_t palette;
+    uint8_t pattern;
+    uint8_t ledCount;
+    int16_t tilt;
+    int16_t accelY;
+    int16_t accelZ;
+  };
+  static_assert(sizeof(Header) == 16, "StatusFrame::Header layout changed");
+
+  struct __attribute__((packed)) Frame {
+    Header header;
+    uint8_t levels[HardwareConfig::NUM_LEDS];
+    uint8_t rgb[HardwareConfig::NUM_LEDS * 3];
+  };
+
+  constexpr size_t SIZE = sizeof(Frame);
+
+  inline int16_t clampInt16(int value) {
+    return (int16_t)constrain(value, -32768, 32767);
+  }
+
+  inline void encode(const DashboardStatus& status, Frame& frame) {
+    Header& header = frame.header;
+    header.magic[0] = 'C';
+    header.magic[1] = 'T';
+    header.version = VERSION;
+    header.flags = (status.liquid ? FLAG_LIQUID : 0) | (status.beat ? FLAG_BEAT : 0);
+    header.bpm = (uint16_t)constrain(status.bpm, 0, 65535);
+    header.batteryPercent = (uint8_t)constrain(status.batteryPercent, 0, 100);
+    header.palette = (uint8_t)status.palette;
+    header.pattern = (uint8_t)status.pattern;
+    header.ledCount = HardwareConfig::NUM_LEDS;
+    header.tilt = clampInt16(status.tilt);
+    header.accelY = clampInt16(status.accelY);
+    header.accelZ = clampInt16(status.accelZ);
+
+    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+      frame.levels[i] = status.leds[i];
+      frame.rgb[i * 3] = (uint8_t)(status.colors[i] >> 16);
+      frame.rgb[i * 3 + 1] = (uint8_t)(status.colors[i] >> 8);
+      frame.rgb[i * 3 + 2] = (uint8_t)status.colors[i];
+    }
+  }
+}
+
+#endif // STATUS_FRAME_H
@@ -0,0 +1,177 @@
+#ifndef STATUS_PUBLISHER_H
+#define STATUS_PUBLISHER_H
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include "../config/Constants.h"
+
+// Dashboard view of the device, captured once per push tick
+// Analog values are quantized (hundredths / percent) so sensor noise below
+// what the dashboard can show does not count as a change.
+template <int NumLeds>
+struct DashboardStatusT {
+  bool liquid = true;
+  int bpm = 0;
+  int batteryPercent = 0;
+  int palette = 0;
+  int pattern = 0;
+  int tilt = 0;                            // tiltAngle x 100
+  int accelY = 0;                          // g x 100
+  int accelZ = 0;                          // g x 100
+  bool beat = false;
+  uint8_t leds[NumLeds] = {0};             // Brightness in percent
+  uint32_t colors[NumLeds] = {0};          // Composed RGB (binary frame only)
+
+  static int hundredths(float value) { return (int)lroundf(value * 100.0f); }
+};
+
+using DashboardStatus = DashboardStatusT<HardwareConfig::NUM_LEDS>;
+
+// Formats status updates for the dashboard push channel
+// Only fields that changed since the last update are written (the dashboard
+// merges them into its state); full snapshots go out for new clients and
+// periodically, so a client that missed a message resynchronizes. Output is
+// the same JSON the /status endpoint served, written into a caller buffer
+// without heap allocation. MAX_MESSAGE_SIZE follows the LED count, so even a
+// full snapshot of the longest strip is never truncated.
+template <int NumLeds>
+class StatusPublisherT {
+public:
+  typedef DashboardStatusT<NumLeds> Status;
+
+  // Widest full snapshot: every field at its widest, then "2.55," per LED
+  // (levels are uint8_t percent)
+  static constexpr size_t FIELDS_MAX_SIZE = sizeof(
+    "{\"mode\":\"liquid\",\"bpm\":-2147483648,\"batteryPercent\":-2147483648,"
+    "\"currentPalette\":-2147483648,\"currentPattern\":-2147483648,"
+    "\"tiltAngle\":-21474836.48,\"accelY\":-21474836.48,\"accelZ\":-21474836.48,"
+    "\"beat\":false,\"leds\":[]}");
+  static constexpr size_t LED_MAX_SIZE = sizeof("2.55,") - 1;
+  static constexpr size_t MAX_MESSAGE_SIZE = FIELDS_MAX_SIZE + NumLeds * LED_MAX_SIZE;
+  static_assert(MAX_MESSAGE_SIZE <= WiFiConfig::STATUS_MAX_BYTES,
+                "Status JSON for this strip exceeds WiFiConfig::STATUS_MAX_BYTES");
+
+private:
+  Status lastSent;
+  bool hasSent;
+  unsigned long lastFullTime;
+
+  // Push statistics
+  unsigned long updatesSent;
+  unsigned long fullUpdatesSent;
+  unsigned long ticksUnchanged;
+  unsigned long bytesSent;
+
+  // Appends printf-style output; keeps track of truncation through `length`
+  static void append(char* out, size_t size, size_t& length, const char* format, ...) {
+    if (length >= size) return;
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(out + length, size - length, format, args);
+    va_end(args);
+    length = written < 0 ? size : length + (size_t)written;
+  }
+
+  static void appendHundredths(char* out, size_t size, size_t& length, const char* key, int value) {
+    append(out, size, length, "%s\"%s\":%s%d.%02d", length > 1 ? "," : "", key,
+           value < 0 ? "-" : "", abs(value) / 100, abs(value) % 100);
+  }
+
+public:
+  StatusPublisherT()
+    : hasSent(false),
+      lastFullTime(0),
+      updatesSent(0),
+      fullUpdatesSent(0),
+      ticksUnchanged(0),
+      bytesSent(0) {}
+
+  // Next update forced to a full snapshot (e.g. a client connected)
+  void requestFull() { hasSent = false; }
+
+  // Writes the update for `status` into `out`; returns its length, or 0 when
+  // nothing changed
+  size_t format(const Status& status, unsigned long currentTime, char* out, size_t size) {
+    bool full = !hasSent || currentTime - lastFullTime >= WiFiConfig::STATUS_FULL_INTERVAL_MS;
+    size_t length = formatFields(status, full ? nullptr : &lastSent, out, size);
+
+    if (length == 0) {
+      ticksUnchanged++;
+      return 0;
+    }
+    if (length >= size) {
+      // Truncated: drop it and send everything next tick
+      hasSent = false;
+      return 0;
+    }
+
+    lastSent = status;
+    hasSent = true;
+    if (full) {
+      lastFullTime = currentTime;
+      fullUpdatesSent++;
+    }
+    updatesSent++;
+    bytesSent += length;
+    return length;
+  }
+
+  // Fields of `status` that differ from `previous` (all of them when null)
+  // as a JSON object; 0 when none differ
+  static size_t formatFields(const Status& status, const Status* previous,
+                             char* out, size_t size) {
+    size_t length = 0;
+    append(out, size, length, "{");
+
+    if (!previous || status.liquid != previous->liquid) {
+      append(out, size, length, "%s\"mode\":\"%s\"", length > 1 ? "," : "", status.liquid ? "liquid" : "tempo");
+    }
+    if (!previous || status.bpm != previous->bpm) {
+      append(out, size, length, "%s\"bpm\":%d", length > 1 ? "," : "", status.bpm);
+    }
+    if (!previous || status.batteryPercent != previous->batteryPercent) {
+      append(out, size, length, "%s\"batteryPercent\":%d", length > 1 ? "," : "", status.batteryPercent);
+    }
+    if (!previous || status.palette != previous->palette) {
+      append(out, size, length, "%s\"currentPalette\":%d", length > 1 ? "," : "", status.palette);
+    }
+    if (!previous || status.pattern != previous->pattern) {
+      append(out, size, length, "%s\"currentPattern\":%d", length > 1 ? "," : "", status.pattern);
+    }
+    if (!previous || status.tilt != previous->tilt) {
+      appendHundredths(out, size, length, "tiltAngle", status.tilt);
+    }
+    if (!previous || status.accelY != previous->accelY) {
+      appendHundredths(out, size, length, "accelY", status.accelY);
+    }
+    if (!previous || status.accelZ != previous->accelZ) {
+      appendHundredths(out, size, length, "accelZ", status.accelZ);
+    }
+    if (!previous || status.beat != previous->beat) {
+      append(out, size, length, "%s\"beat\":%s", length > 1 ? "," : "", status.beat ? "true" : "false");
+    }
+    if (!previous || memcmp(status.leds, previous->leds, sizeof(status.leds)) != 0) {
+      append(out, size, length, "%s\"leds\":[", length > 1 ? "," : "");
+      for (int i = 0; i < NumLeds; i++) {
+        int level = status.leds[i];
+        append(out, size, length, "%s%d.%02d", i ? "," : "", level / 100, level % 100);
+      }
+      append(out, size, length, "]");
+    }
+
+    if (length == 1) return 0;  // Only "{": nothing changed
+    append(out, size, length, "}");
+    return length;
+  }
+
+  // Statistics
+  unsigned long getUpdatesSent() const { return updatesSent; }
+  unsigned long getFullUpdatesSent() const { return fullUpdatesSent; }
+  unsigned long getTicksUnchanged() const { return ticksUnchanged; }
+  unsigned long getBytesSent() const { return bytesSent; }
+};
+
+// Publisher for the strip this firmware is built for
+using StatusPublisher = StatusPublisherT<HardwareConfig::NUM_LEDS>;
+
+#endif // STATUS_PUBLISHER_H
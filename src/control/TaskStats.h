@@ -0,0 +1,82 @@
+#ifndef TASK_STATS_H
+#define TASK_STATS_H
+
+#include <Arduino.h>
+
+// Load and stack figures for one FreeRTOS task, kept by the task itself
+// The task brackets each pass of its work with beginWork()/endWork(); busy
+// time is summed over 1 s windows like the MPU bus statistics. Other tasks
+// only read the figures (single words, for display).
+class TaskStats {
+private:
+  const char* name;
+  int priority;
+  unsigned long iterations;
+  unsigned long workStart;
+  uint32_t stackFree;                // Bytes never used (high-water mark)
+
+  // Busy time, microseconds
+  unsigned long windowStart;
+  unsigned long busyInWindow;
+  unsigned long longestInWindow;
+  unsigned long busyPerSecond;
+  unsigned long longestStep;
+
+public:
+  TaskStats(const char* taskName, int taskPriority)
+    : name(taskName),
+      priority(taskPriority),
+      iterations(0),
+      workStart(0),
+      stackFree(0),
+      windowStart(0),
+      busyInWindow(0),
+      longestInWindow(0),
+      busyPerSecond(0),
+      longestStep(0) {}
+
+  void beginWork(unsigned long currentMicros) {
+    workStart = currentMicros;
+  }
+
+  void endWork(unsigned long currentMicros) {
+    unsigned long busy = currentMicros - workStart;
+    if (currentMicros - windowStart >= 1000000UL) {
+      unsigned long elapsed = currentMicros - windowStart;
+      busyPerSecond = elapsed < 2000000UL ? (unsigned long)((uint64_t)busyInWindow * 1000000ULL / elapsed) : 0;
+      longestStep = longestInWindow;
+      windowStart = currentMicros;
+      busyInWindow = 0;
+      longestInWindow = 0;
+    }
+    busyInWindow += busy;
+    if (busy > longestInWindow) longestInWindow = busy;
+    iterations++;
+  }
+
+  void setStackFree(uint32_t bytes) { stackFree = bytes; }
+
+  const char* getName() const { return name; }
+  int getPriority() const { return priority; }
+  unsigned long getIterations() const { return iterations; }
+  uint32_t getStackFree() const { return stackFree; }
+  unsigned long getBusyMicrosPerSecond() const { return busyPerSecond; }
+  unsigned long getLongestStepMicros() const { return longestStep; }
+
+  void print() const {
+    Serial.print("🧵 ");
+    Serial.print(name);
+    Serial.print(" (prio ");
+    Serial.print(priority);
+    Serial.print(") | load ");
+    Serial.print(busyPerSecond / 10000.0f, 1);
+    Serial.print("% | longest ");
+    Serial.print(longestStep);
+    Serial.print(" us | stack free ");
+    Serial.print(stackFree);
+    Serial.print(" B | passes ");
+    Serial.println(iterations);
+  }
+};
+
+#endif // TASK_STATS_H
@@ -7,30 +7,58 @@
 #include <ArduinoJson.h>
 #include <functional>
 #include "../config/Constants.h"
+#include "DashboardAsset.h"
+#include "StatusFrame.h"
+#include "CommandParser.h"
+#include "RequestBody.h"
+
+// Outcome of a POST /command batch
+enum class CommandResult {
+  QUEUED,     // Accepted; applied together at the start of the next frame
+  INVALID,    // Unknown or malformed command: nothing queued
+  BUSY        // No room for the batch: nothing queued, retry
+};
 
 // WiFi and web server management
+// Dashboard state is pushed over Server-Sent Events on /events ("status"
+// events carrying JSON deltas); /status (JSON) and /status.bin (StatusFrame)
+// answer one-off requests. Pushes come from the network task, not AsyncTCP:
+// that relies on ESP32Async/ESPAsyncWebServer, whose AsyncEventSource holds
+// its client-list lock in send() and count() (me-no-dev's original walks the
+// list unlocked while AsyncTCP adds and removes clients).
+// The page itself is served gzipped from flash (DashboardAsset.h, built by
+// scripts/embed_dashboard.py) with an ETag, so a reloading phone gets a 304.
 class CtenophoreWiFiServer {
 private:
   AsyncWebServer* server;
+  AsyncEventSource* events;
+  volatile bool clientJoined;  // Set from the async TCP task on connect
   const char* ssid;
   const char* password;
-  std::function<void(String)> onCommand;
+  std::function<CommandResult(const CommandText*, int)> onCommand;
+  RequestBody commandBody;
   std::function<String()> onGetStatus;
+  std::function<size_t(uint8_t*, size_t)> onGetStatusFrame;
+  std::function<size_t(char*, size_t)> onGetMetrics;
+  char metricsText[WiFiConfig::METRICS_MAX_BYTES];  // Handlers all run on the async TCP task
   const char* dashboardHTML;
 
 public:
   CtenophoreWiFiServer(const char* ssidName, const char* pass, const char* htmlContent)
     : server(new AsyncWebServer(WiFiConfig::SERVER_PORT)),
+      events(new AsyncEventSource("/events")),
+      clientJoined(false),
       ssid(ssidName),
       password(pass),
       dashboardHTML(htmlContent) {}
 
   ~CtenophoreWiFiServer() {
     delete server;
+    delete events;
   }
 
-  // Set command callback
-  void setCommandCallback(std::function<void(String)> callback) {
+  // Set command callback (called from the async TCP task with a whole batch)
+  void setCommandCallback(std::function<CommandResult(const CommandText*, int)> callback) {
     onCommand = callback;
   }
 
@@ -39,6 +67,16 @@ public:
     onGetStatus = callback;
   }
 
+  // Set binary status frame callback (writes the frame, returns its size)
+  void setStatusFrameCallback(std::function<size_t(uint8_t*, size_t)> callback) {
+    onGetStatusFrame = callback;
+  }
+
+  // Set metrics callback (writes Prometheus text, returns its length)
+  void setMetricsCallback(std::function<size_t(char*, size_t)> callback) {
+    onGetMetrics = callback;
+  }
+
   // Initialize WiFi hotspot
   bool begin() {
     Serial.println("🔧 Starting WiFi setup...");
@@ -68,11 +106,38 @@ public:
     return false;
   }
 
+  // Cacheable, but checked with the device before each use
+  static void addCacheHeaders(AsyncWebServerResponse *response) {
+    response->addHeader("ETag", DashboardAsset::ETAG);
+    response->addHeader("Cache-Control", "no-cache");
+  }
+
   // Setup web server routes
   void setupRoutes() {
-    // Serve dashboard HTML
+    // Serve dashboard HTML (revalidated on every load via its ETag)
     server->on("/", HTTP_GET, [this](AsyncWebServerRequest *request){
-      request->send(200, "text/html", dashboardHTML);
+      if (request->hasHeader("If-None-Match") &&
+          request->header("If-None-Match") == DashboardAsset::ETAG) {
+        AsyncWebServerResponse *response = request->beginResponse(304);
+        addCacheHeaders(response);
+        request->send(response);
+        return;
+      }
+
+      // Every phone browser accepts gzip; keep the plain page for anything else
+      AsyncWebServerResponse *response;
+      if (request->hasHeader("Accept-Encoding") &&
+          request->header("Accept-Encoding").indexOf("gzip") >= 0) {
+        response = request->beginResponse_P(200, "text/html", DashboardAsset::GZIP, DashboardAsset::GZIP_SIZE);
+        response->addHeader("Content-Encoding", "gzip");
+        addCacheHeaders(response);
+      } else {
+        // No ETag: it names the gzip representation
+        response = request->beginResponse_P(200, "text/html", dashboardHTML);
+        response->addHeader("Cache-Control", "no-cache");
+      }
+      response->addHeader("Vary", "Accept-Encoding");
+      request->send(response);
     });
 
     // Status endpoint
@@ -85,25 +150,103 @@ public:
       }
     });
 
-    // Command endpoint
-    server->on("/command", HTTP_POST, [](AsyncWebServerRequest *request){}, NULL,
+    // Binary status frame (see StatusFrame.h)
+    server->on("/status.bin", HTTP_GET, [this](AsyncWebServerRequest *request){
+      uint8_t frame[StatusFrame::SIZE];
+      size_t length = onGetStatusFrame ? onGetStatusFrame(frame, sizeof(frame)) : 0;
+      if (length == 0) {
+        request->send(500, "application/json", "{\"error\":\"no status handler\"}");
+        return;
+      }
+
+      // Stream response: copies the frame before the handler returns
+      AsyncResponseStream *response = request->beginResponseStream("application/octet-stream", length);
+      response->write(frame, length);
+      response->addHeader("Cache-Control", "no-store");
+      request->send(response);
+    });
+
+    // Stage timings for scrapers and curl
+    server->on("/metrics", HTTP_GET, [this](AsyncWebServerRequest *request){
+      size_t length = onGetMetrics ? onGetMetrics(metricsText, sizeof(metricsText)) : 0;
+      if (length == 0) {
+        request->send(500, "application/json", "{\"error\":\"no metrics handler\"}");
+        return;
+      }
+      length = min(length, sizeof(metricsText) - 1);
+
+      AsyncResponseStream *response = request->beginResponseStream("text/plain; version=0.0.4", length);
+      response->write((const uint8_t*)metricsText, length);
+      response->addHeader("Cache-Control", "no-store");
+      request->send(response);
+    });
+
+    // Status push channel
+    events->onConnect([this](AsyncEventSourceClient *client){
+      client->send("connected", NULL, millis(), WiFiConfig::EVENTS_RECONNECT_MS);
+      clientJoined = true;
+    });
+    server->addHandler(events);
+
+    // Command endpoint: {"command": "..."} or {"commands": ["...", ...]}
+    server->on("/command", HTTP_POST, [](AsyncWebServerRequest*){}, NULL,
       [this](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total){
-        String body = String((char*)data).substring(0, len);
+        RequestBody::Status status = commandBody.append(request, data, len, index, total);
+        if (status == RequestBody::PARTIAL || !RequestBody::isLastChunk(len, index, total)) return;
 
-        StaticJsonDocument<128> doc;
-        DeserializationError error = deserializeJson(doc, body);
+        switch (status) {
+          case RequestBody::COMPLETE:
+            break;
+          case RequestBody::TOO_LARGE:
+            request->send(413, "application/json", "{\"error\":\"body too large\"}");
+            return;
+          case RequestBody::BUSY:
+            request->send(503, "application/json", "{\"error\":\"busy\"}");
+            return;
+          default:
+            request->send(400, "application/json", "{\"error\":\"malformed body\"}");
+            return;
+        }
 
-        if (!error) {
-          String command = doc["command"];
+        // Parsed in place: strings in `doc` point into commandBody
+        StaticJsonDocument<512> doc;
+        DeserializationError error = deserializeJson(doc, commandBody.getData(), commandBody.getLength());
+        if (error) {
+          request->send(400, "application/json", "{\"error\":\"invalid json\"}");
+          return;
+        }
+        if (!onCommand) {
+          request->send(500, "application/json", "{\"error\":\"no command handler\"}");
+          return;
+        }
 
-          if (onCommand) {
-            onCommand(command);
-            request->send(200, "application/json", "{\"status\":\"ok\"}");
-          } else {
-            request->send(500, "application/json", "{\"error\":\"no command handler\"}");
+        CommandText batch[WiFiConfig::MAX_BATCH_COMMANDS];
+        int count = 0;
+        bool valid = true;
+        if (doc["commands"].is<JsonArray>()) {
+          for (JsonVariant command : doc["commands"].as<JsonArray>()) {
+            const char* text = command.as<const char*>();
+            if (!text || count >= WiFiConfig::MAX_BATCH_COMMANDS) {
+              valid = false;
+              break;
+            }
+            batch[count++] = CommandText(text);
           }
-        } else {
-          request->send(400, "application/json", "{\"error\":\"invalid json\"}");
+        } else if (const char* text = doc["command"]) {
+          batch[count++] = CommandText(text);
+        }
+
+        CommandResult result = valid && count > 0 ? onCommand(batch, count) : CommandResult::INVALID;
+        switch (result) {
+          case CommandResult::QUEUED:
+            request->send(200, "application/json", "{\"status\":\"ok\"}");
+            break;
+          case CommandResult::BUSY:
+            request->send(503, "application/json", "{\"error\":\"busy\"}");
+            break;
+          default:
+            request->send(400, "application/json", "{\"error\":\"invalid command\"}");
+            break;
         }
       });
 
@@ -113,6 +256,24 @@ public:
     });
   }
 
+  // Push channel: dashboards currently listening (any task; count() locks)
+  bool hasStatusListeners() const {
+    return events->count() > 0;
+  }
+
+  // True once after a dashboard connected (it needs a full snapshot)
+  bool takeClientJoined() {
+    if (!clientJoined) return false;
+    clientJoined = false;
+    return true;
+  }
+
+  // Broadcast a status update to every connected dashboard (any task; send()
+  // locks the client list and queues per client)
+  void pushStatus(const char* json) {
+    events->send(json, "status", millis());
+  }
+
   // Get connection info
   IPAddress getIP() const {
     return WiFi.softAPIP();
@@ -134,6 +295,8 @@ public:
     Serial.println(getIP());
     Serial.print("  Clients: ");
     Serial.println(getClientCount());
+    Serial.print("  Dashboards listening: ");
+    Serial.println(events->count());
   }
 };
 
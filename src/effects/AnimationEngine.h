@@ -3,8 +3,10 @@
 
 #include <Arduino.h>
 #include "../config/Constants.h"
+#include "../config/StripGeometry.h"
 #include "../hardware/LEDController.h"
 #include "PaletteManager.h"
+#include "ColorMath.h"
 
 // Animation pattern types
 enum AnimationPattern {
@@ -18,14 +20,19 @@ enum AnimationPattern {
 };
 
 // Animation engine handles all visual effects
-class AnimationEngine {
+// Templated on the pixel count: per-pixel loops are bounded at compile time and
+// effect sizes (liquid blob, ripple) scale with the strip via StripGeometry.
+template <int NumLeds>
+class AnimationEngineT {
 private:
+  typedef StripGeometry<NumLeds> Geometry;
+
   // Current pattern
   AnimationPattern currentPattern = PATTERN_RAINBOW_CYCLE;
 
   // LED brightness levels (0.0 - 1.0)
-  float liquidLevels[HardwareConfig::NUM_LEDS];
-  float targetLevels[HardwareConfig::NUM_LEDS];
+  float liquidLevels[NumLeds];
+  float targetLevels[NumLeds];
 
   // Animation state
   float breathPhase = 0;
@@ -34,26 +41,26 @@ private:
   bool chaseDirection = true;
 
   // Sparkle state
-  bool sparkleStates[HardwareConfig::NUM_LEDS];
-  unsigned long sparkleTimers[HardwareConfig::NUM_LEDS];
+  bool sparkleStates[NumLeds];
+  unsigned long sparkleTimers[NumLeds];
   unsigned long lastIdleSparkle = 0;
 
   // Timing
   unsigned long lastAnimationUpdate = 0;
 
   // References
-  LEDController* leds;
-  PaletteManager* palettes;
+  LEDControllerT<NumLeds>* leds;
+  PaletteManagerT<NumLeds>* palettes;
 
   // Tempo-reactive coloring
   bool tempoColorReactive = false;
   float temperatureShift = 0;  // -1.0 (cool) to +1.0 (warm)
 
 public:
-  AnimationEngine(LEDController* ledController, PaletteManager* paletteManager)
+  AnimationEngineT(LEDControllerT<NumLeds>* ledController, PaletteManagerT<NumLeds>* paletteManager)
     : leds(ledController), palettes(paletteManager) {
     // Initialize levels
-    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    for (int i = 0; i < NumLeds; i++) {
       liquidLevels[i] = 1.0;
       targetLevels[i] = 1.0;
       sparkleStates[i] = false;
@@ -98,7 +105,7 @@ public:
     }
   }
 
-  // Render LEDs with current palette and levels
+  // Compose the frame with current palette and levels (does not latch)
   void render(float tiltAngle = 0) {
     // Get palette (possibly tilt-based)
     int paletteIndex = palettes->getPaletteIndexForTilt(tiltAngle);
@@ -106,8 +113,12 @@ public:
 
     if (!palette) return;
 
+    // Per-frame fixed-point parameters (hue base and temperature gains)
+    uint32_t hueBase = ColorMath::hueFromDegrees(globalHueShift);
+    ColorMath::TemperatureGains gains = ColorMath::temperatureGains(temperatureShift);
+
     // Apply colors to LEDs
-    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    for (int i = 0; i < NumLeds; i++) {
       uint32_t color;
 
       // Check for custom LED override
@@ -116,31 +127,21 @@ public:
         if (customColor != 0) {
           color = customColor;
         } else {
-          color = getColorFromPalette(palette, i);
+          color = getColorFromPalette(palette, i, hueBase);
         }
       } else {
-        color = getColorFromPalette(palette, i);
+        color = getColorFromPalette(palette, i, hueBase);
       }
 
       // Apply tempo-reactive color temperature
       if (tempoColorReactive) {
-        color = LEDController::adjustColorTemperature(color, temperatureShift);
+        color = ColorMath::applyTemperature(color, gains);
       }
 
-      // Apply brightness level
-      uint8_t r = (color >> 16) & 0xFF;
-      uint8_t g = (color >> 8) & 0xFF;
-      uint8_t b = color & 0xFF;
-
-      float level = liquidLevels[i];
-      r = r * level;
-      g = g * level;
-      b = b * level;
-
-      leds->setColorRGB(i, r, g, b);
+      // Apply brightness level (sub-LSB part goes to the dithered output)
+      leds->setColorScaled(i, color, ColorMath::levelFromFloat(liquidLevels[i]));
     }
-
-    leds->show();
+    // Latching is left to the frame loop (LEDController::show)
   }
 
   // Pattern-specific update functions
@@ -148,14 +149,14 @@ public:
     breathPhase += 0.05;
     float pulse = 0.3 + 0.7 * (sin(breathPhase) + 1) / 2;
 
-    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    for (int i = 0; i < NumLeds; i++) {
       liquidLevels[i] = liquidLevels[i] * pulse;
     }
   }
 
   void updateChaseEffect() {
     // Clear all LEDs
-    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    for (int i = 0; i < NumLeds; i++) {
       liquidLevels[i] = EffectsConfig::DIM_BRIGHTNESS;
     }
 
@@ -165,8 +166,8 @@ public:
     // Move chase position
     if (chaseDirection) {
       chasePosition++;
-      if (chasePosition >= HardwareConfig::NUM_LEDS) {
-        chasePosition = HardwareConfig::NUM_LEDS - 1;
+      if (chasePosition >= NumLeds) {
+        chasePosition = Geometry::LAST;
         chaseDirection = false;
       }
     } else {
@@ -180,7 +181,7 @@ public:
 
   void updateSparkleEffect() {
     // Randomly trigger sparkles
-    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    for (int i = 0; i < NumLeds; i++) {
       if (!sparkleStates[i] && random(100) < 5) { // 5% chance per frame
         sparkleStates[i] = true;
         sparkleTimers[i] = millis();
@@ -199,7 +200,7 @@ public:
     static float fadePhase = 0;
     fadePhase += 0.02;
 
-    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    for (int i = 0; i < NumLeds; i++) {
       float phase = fadePhase + (i * 0.3);
       liquidLevels[i] = 0.2 + 0.8 * (sin(phase) + 1) / 2;
     }
@@ -210,47 +211,51 @@ public:
     if (!isActive) return;
 
     // Clear all LEDs
-    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    for (int i = 0; i < NumLeds; i++) {
       targetLevels[i] = EffectsConfig::DIM_BRIGHTNESS;
     }
 
     // Tilt-based liquid simulation
     if (abs(tiltAngle) < 0.15) {
-      // Centered - all LEDs mid-level
-      targetLevels[3] = EffectsConfig::MAX_BRIGHTNESS;
+      // Centered - liquid pools in the middle
+      for (int i = 0; i < NumLeds; i++) {
+        if (abs(i - Geometry::CENTER) < Geometry::LIQUID_CENTER_SPREAD) {
+          targetLevels[i] = EffectsConfig::MAX_BRIGHTNESS;
+        }
+      }
     } else {
       // Tilted - liquid flows to one side
       float normalizedTilt = constrain(tiltAngle, -1.0, 1.0);
-      float ledPosition = (normalizedTilt + 1.0) / 2.0 * (HardwareConfig::NUM_LEDS - 1);
+      float ledPosition = (normalizedTilt + 1.0) / 2.0 * Geometry::LAST;
 
-      for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+      for (int i = 0; i < NumLeds; i++) {
         float distance = abs(i - ledPosition);
-        if (distance < 1.5) {
-          targetLevels[i] = EffectsConfig::MAX_BRIGHTNESS * (1.5 - distance) / 1.5;
+        if (distance < Geometry::LIQUID_SPREAD) {
+          targetLevels[i] = EffectsConfig::MAX_BRIGHTNESS * (Geometry::LIQUID_SPREAD - distance) / Geometry::LIQUID_SPREAD;
         }
       }
     }
 
     // Smooth transition to target levels
-    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    for (int i = 0; i < NumLeds; i++) {
       liquidLevels[i] += (targetLevels[i] - liquidLevels[i]) * 0.15;
     }
   }
 
   // Ripple effect (for tap feedback)
   void doRippleEffect(float& wavePosition) {
-    wavePosition += EffectsConfig::WAVE_SPEED;
+    wavePosition += Geometry::WAVE_SPEED;
 
-    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    for (int i = 0; i < NumLeds; i++) {
       float distance = abs(i - wavePosition);
 
-      if (distance <= EffectsConfig::TRAIL_LENGTH) {
-        float rippleBrightness = cos(distance * PI / (EffectsConfig::TRAIL_LENGTH * 2)) * EffectsConfig::MAX_BRIGHTNESS;
+      if (distance <= Geometry::TRAIL_LENGTH) {
+        float rippleBrightness = cos(distance * PI / (Geometry::TRAIL_LENGTH * 2)) * EffectsConfig::MAX_BRIGHTNESS;
         if (rippleBrightness < 0) rippleBrightness = 0;
         liquidLevels[i] = max(liquidLevels[i], rippleBrightness);
       }
 
-      if (distance > EffectsConfig::TRAIL_LENGTH) {
+      if (distance > Geometry::TRAIL_LENGTH) {
         liquidLevels[i] *= 0.85;
         if (liquidLevels[i] < EffectsConfig::DIM_BRIGHTNESS) {
           liquidLevels[i] = EffectsConfig::DIM_BRIGHTNESS;
@@ -264,7 +269,7 @@ public:
 
   // Rotation sparkle effect
   void triggerRotationSparkle() {
-    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    for (int i = 0; i < NumLeds; i++) {
       sparkleStates[i] = true;
       sparkleTimers[i] = millis();
       liquidLevels[i] = EffectsConfig::MAX_BRIGHTNESS;
@@ -289,13 +294,13 @@ public:
 
   // Level access (for external manipulation)
   void setLevel(int led, float level) {
-    if (led >= 0 && led < HardwareConfig::NUM_LEDS) {
+    if (led >= 0 && led < NumLeds) {
       liquidLevels[led] = constrain(level, 0.0, 1.0);
     }
   }
 
   float getLevel(int led) const {
-    if (led >= 0 && led < HardwareConfig::NUM_LEDS) {
+    if (led >= 0 && led < NumLeds) {
       return liquidLevels[led];
     }
     return 0;
@@ -303,7 +308,7 @@ public:
 
   void setAllLevels(float level) {
     level = constrain(level, 0.0, 1.0);
-    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    for (int i = 0; i < NumLeds; i++) {
       liquidLevels[i] = level;
     }
   }
@@ -320,49 +325,22 @@ public:
 
 private:
   // Get color from palette for specific LED
-  uint32_t getColorFromPalette(ColorPalette* palette, int ledIndex) {
+  uint32_t getColorFromPalette(ColorPalette* palette, int ledIndex, uint32_t hueBase) {
     if (!palette || palette->colorCount == 0) {
       return 0xFFFFFF; // White default
     }
 
-    // Rainbow pattern uses hue shift
+    // Rainbow pattern uses hue shift, LEDs spread evenly around the wheel
     if (currentPattern == PATTERN_RAINBOW_CYCLE) {
-      float hue = (globalHueShift + (ledIndex * 360.0 / HardwareConfig::NUM_LEDS)) / 360.0;
-      hue = fmod(hue, 1.0);
-      return hsvToRgb(hue, 1.0, 1.0);
+      const uint32_t hueStep = (uint32_t)(ColorMath::HUE_TURN / NumLeds);
+      return ColorMath::hueToRgb(hueBase + ledIndex * hueStep);
     }
 
     // Map LED to palette color
-    int colorIndex = (ledIndex * palette->colorCount) / HardwareConfig::NUM_LEDS;
+    int colorIndex = (ledIndex * palette->colorCount) / NumLeds;
     return palette->colors[colorIndex];
   }
 
-  // HSV to RGB conversion
-  uint32_t hsvToRgb(float h, float s, float v) {
-    h = constrain(h, 0.0, 1.0);
-    s = constrain(s, 0.0, 1.0);
-    v = constrain(v, 0.0, 1.0);
-
-    float hue = h * 6.0;
-    float c = v * s;
-    float x = c * (1.0 - abs(fmod(hue, 2.0) - 1.0));
-    float m = v - c;
-
-    float r, g, b;
-    if (hue < 1.0)      { r = c; g = x; b = 0; }
-    else if (hue < 2.0) { r = x; g = c; b = 0; }
-    else if (hue < 3.0) { r = 0; g = c; b = x; }
-    else if (hue < 4.0) { r = 0; g = x; b = c; }
-    else if (hue < 5.0) { r = x; g = 0; b = c; }
-    else                { r = c; g = 0; b = x; }
-
-    uint8_t rByte = (r + m) * 255;
-    uint8_t gByte = (g + m) * 255;
-    uint8_t bByte = (b + m) * 255;
-
-    return ((uint32_t)rByte << 16) | ((uint32_t)gByte << 8) | bByte;
-  }
-
   // === ADDITIONAL PUBLIC METHODS ===
 public:
   // Strobe control
@@ -399,4 +377,7 @@ public:
   }
 };
 
+// Animation engine for the strip this firmware is built for
+using AnimationEngine = AnimationEngineT<HardwareConfig::NUM_LEDS>;
+
 #endif // ANIMATION_ENGINE_H
@@ -0,0 +1,166 @@
+#ifndef COLOR_MATH_H
+#define COLOR_MATH_H
+
+#include <Arduino.h>
+
+// Integer color math for the render hot path
+// The ESP32-C3 has no FPU, so per-pixel work stays in integers. Brightness
+// levels are 0.16 fixed point and color temperature gains 8.8; each is
+// converted from float once and applied with a multiply and a shift, within
+// 1 LSB of the float channel math. Hues are a uint32_t angle looked up in a
+// compile-time wheel table (within 1 LSB of the float hsvToRgb()).
+namespace ColorMath {
+  // Hue angle: the full uint32_t range is one turn, so wrap-around is free
+  constexpr uint64_t HUE_TURN = 1ULL << 32;
+
+  inline uint8_t red(uint32_t color) { return (color >> 16) & 0xFF; }
+  inline uint8_t green(uint32_t color) { return (color >> 8) & 0xFF; }
+  inline uint8_t blue(uint32_t color) { return color & 0xFF; }
+
+  constexpr uint32_t pack(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+
+  // Brightness level, 0.16 fixed point: 16 bits below 1.0 leave the output
+  // stage 8 bits below the strip's LSB
+  typedef uint32_t Level;
+  constexpr Level LEVEL_FULL = 1UL << 16;
+
+  inline Level levelFromFloat(float value) {
+    if (!(value > 0.0f)) return 0;
+    if (value >= 1.0f) return LEVEL_FULL;
+    return (Level)(value * LEVEL_FULL + 0.5f);
+  }
+
+  // channel * level, truncated to 8 bits
+  inline uint8_t scaleChannel(uint8_t channel, Level level) {
+    return (uint8_t)(((uint32_t)channel * level) >> 16);
+  }
+
+  // channel * level as 8.8 fixed point (fraction kept for the dithered output stage)
+  inline uint16_t scaleChannel16(uint8_t channel, Level level) {
+    return (uint16_t)(((uint32_t)channel * level) >> 8);
+  }
+
+  // Scale all three channels by a level
+  inline uint32_t scaleColor(uint32_t color, Level level) {
+    return pack(scaleChannel(red(color), level),
+                scaleChannel(green(color), level),
+                scaleChannel(blue(color), level));
+  }
+
+  // Channel gain, 8.8 fixed point (256 = unity, up to 2.0)
+  typedef uint16_t Gain;
+
+  inline Gain gainFromFloat(float value) {
+    value = constrain(value, 0.0f, 2.0f);
+    return (Gain)(value * 256.0f + 0.5f);
+  }
+
+  // min(255, channel * gain)
+  inline uint8_t gainChannel(uint8_t channel, Gain gain) {
+    uint32_t value = ((uint32_t)channel * gain) >> 8;
+    return value > 255 ? 255 : (uint8_t)value;
+  }
+
+  // Degrees (any range) to a hue angle; call once per frame, not per pixel
+  inline uint32_t hueFromDegrees(float degrees) {
+    double turns = degrees / 360.0;
+    turns -= floor(turns);
+    return (uint32_t)(uint64_t)(turns * (double)HUE_TURN);
+  }
+
+  // ===== HUE TABLE =====
+  // Fully saturated hue wheel: 6 sectors x 256 steps, generated at compile
+  // time into flash. Entry values are the wheel color at the start of each
+  // step, so a lookup is within 1 LSB of the exact conversion.
+  constexpr int HUE_STEPS_PER_SECTOR = 256;
+  constexpr int HUE_TABLE_SIZE = 6 * HUE_STEPS_PER_SECTOR;
+
+  constexpr uint8_t hueRamp(int step) {
+    return (uint8_t)((255 * step) / HUE_STEPS_PER_SECTOR);
+  }
+
+  constexpr uint32_t hueSectorColor(int sector, uint8_t rising, uint8_t falling) {
+    return sector == 0 ? pack(255, rising, 0) :
+           sector == 1 ? pack(falling, 255, 0) :
+           sector == 2 ? pack(0, 255, rising) :
+           sector == 3 ? pack(0, falling, 255) :
+           sector == 4 ? pack(rising, 0, 255) :
+                         pack(255, 0, falling);
+  }
+
+  constexpr uint32_t hueTableEntry(int index) {
+    return hueSectorColor(index / HUE_STEPS_PER_SECTOR,
+                          hueRamp(index % HUE_STEPS_PER_SECTOR),
+                          hueRamp(HUE_STEPS_PER_SECTOR - index % HUE_STEPS_PER_SECTOR));
+  }
+
+  // Index pack 0..N-1 built by halving, so template depth stays at log2(N)
+  template <int... I> struct IndexList {};
+
+  template <typename A, typename B> struct JoinIndices;
+  template <int... A, int... B>
+  struct JoinIndices<IndexList<A...>, IndexList<B...> > {
+    typedef IndexList<A..., (int)sizeof...(A) + B...> type;
+  };
+
+  template <int N> struct MakeIndices {
+    typedef typename JoinIndices<typename MakeIndices<N / 2>::type,
+                                 typename MakeIndices<N - N / 2>::type>::type type;
+  };
+  template <> struct MakeIndices<0> { typedef IndexList<> type; };
+  template <> struct MakeIndices<1> { typedef IndexList<0> type; };
+
+  template <typename Indices> struct HueTable;
+  template <int... I>
+  struct HueTable<IndexList<I...> > {
+    static constexpr uint32_t colors[sizeof...(I)] = {hueTableEntry(I)...};
+  };
+  template <int... I>
+  constexpr uint32_t HueTable<IndexList<I...> >::colors[sizeof...(I)];
+
+  typedef HueTable<MakeIndices<HUE_TABLE_SIZE>::type> HueWheel;
+
+  // Fully saturated, full value hue to packed RGB
+  inline uint32_t hueToRgb(uint32_t hue) {
+    return HueWheel::colors[((uint64_t)hue * HUE_TABLE_SIZE) >> 32];
+  }
+
+  // Hue as a 0.0 - 1.0 fraction of the wheel to a hue angle
+  inline uint32_t hueFromFraction(float fraction) {
+    fraction = constrain(fraction, 0.0f, 1.0f);
+    return (uint32_t)(uint64_t)(fraction * (float)HUE_TURN);
+  }
+
+  // Color temperature gains for red and blue, computed once per frame
+  // temperature: -1.0 (cool) to +1.0 (warm)
+  struct TemperatureGains {
+    Gain red;
+    Gain blue;
+  };
+
+  inline TemperatureGains temperatureGains(float temperature) {
+    temperature = constrain(temperature, -1.0f, 1.0f);
+    TemperatureGains gains;
+    if (temperature > 0) {
+      // Warm: increase red, decrease blue
+      gains.red = gainFromFloat(1.0f + temperature * 0.3f);
+      gains.blue = gainFromFloat(1.0f - temperature * 0.3f);
+    } else {
+      // Cool: decrease red, increase blue
+      float coolFactor = -temperature;
+      gains.red = gainFromFloat(1.0f - coolFactor * 0.3f);
+      gains.blue = gainFromFloat(1.0f + coolFactor * 0.3f);
+    }
+    return gains;
+  }
+
+  inline uint32_t applyTemperature(uint32_t color, const TemperatureGains& gains) {
+    return pack(gainChannel(red(color), gains.red),
+                green(color),
+                gainChannel(blue(color), gains.blue));
+  }
+}
+
+#endif // COLOR_MATH_H
@@ -19,7 +19,9 @@ struct TiltZone {
 };
 
 // Manages color palettes and tilt-based switching
-class PaletteManager {
+// NumLeds sizes the per-LED custom color overrides.
+template <int NumLeds>
+class PaletteManagerT {
 private:
   // Predefined palettes
   ColorPalette palettes[PaletteConfig::PREDEFINED_PALETTE_COUNT] = {
@@ -51,11 +53,11 @@ private:
   unsigned long lastRandomChange = 0;
 
   // Custom LED color overrides
-  uint32_t customLEDColors[HardwareConfig::NUM_LEDS] = {0};
+  uint32_t customLEDColors[NumLeds] = {0};
   bool useCustomColors = false;
 
 public:
-  PaletteManager() {}
+  PaletteManagerT() {}
 
   // Get current palette
   ColorPalette* getCurrentPalette() {
@@ -154,7 +156,7 @@ public:
 
   // Custom LED color overrides
   void setCustomLEDColor(int led, uint32_t color) {
-    if (led >= 0 && led < HardwareConfig::NUM_LEDS) {
+    if (led >= 0 && led < NumLeds) {
       customLEDColors[led] = color;
       useCustomColors = true;
     }
@@ -162,14 +164,14 @@ public:
 
   void clearCustomColors() {
     useCustomColors = false;
-    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    for (int i = 0; i < NumLeds; i++) {
       customLEDColors[i] = 0;
     }
   }
 
   bool hasCustomColors() const { return useCustomColors; }
   uint32_t getCustomLEDColor(int led) const {
-    if (led >= 0 && led < HardwareConfig::NUM_LEDS) {
+    if (led >= 0 && led < NumLeds) {
       return customLEDColors[led];
     }
     return 0;
@@ -225,4 +227,7 @@ public:
   }
 };
 
+// Palette manager for the strip this firmware is built for
+using PaletteManager = PaletteManagerT<HardwareConfig::NUM_LEDS>;
+
 #endif // PALETTE_MANAGER_H
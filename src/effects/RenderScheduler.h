@@ -0,0 +1,133 @@
+#ifndef RENDER_SCHEDULER_H
+#define RENDER_SCHEDULER_H
+
+#include <Arduino.h>
+#include "../config/Constants.h"
+
+// Fixed-rate frame pacing for the render path
+// Frames are scheduled additively (like BeatSynchronizer) so the rate does not
+// drift; each frame's work is timed against the frame budget.
+class RenderScheduler {
+private:
+  unsigned long frameInterval;    // Microseconds between frames
+  unsigned long nextFrameTime = 0;
+  unsigned long frameStartTime = 0;
+  bool started = false;
+
+  // Frame statistics
+  unsigned long framesRendered = 0;
+  unsigned long framesOverBudget = 0;
+  unsigned long framesDropped = 0;   // Frame slots missed because we fell behind
+  unsigned long lastFrameTime = 0;   // Work time of the last frame (us)
+  unsigned long maxFrameTime = 0;
+  unsigned long totalFrameTime = 0;
+
+public:
+  RenderScheduler(int targetFps = EffectsConfig::TARGET_FPS)
+    : frameInterval(1000000UL / targetFps) {}
+
+  // Change the frame rate (takes effect from the next frame)
+  void setTargetFPS(int fps) {
+    if (fps > 0) {
+      frameInterval = 1000000UL / fps;
+    }
+  }
+
+  int getTargetFPS() const {
+    return (int)(1000000UL / frameInterval);
+  }
+
+  // Check if a frame is due; if so, the frame slot is consumed
+  bool frameDue(unsigned long currentMicros) {
+    if (!started) {
+      started = true;
+      nextFrameTime = currentMicros;
+    }
+
+    if ((long)(currentMicros - nextFrameTime) < 0) {
+      return false;
+    }
+
+    // ADDITIVE timing - keeps the frame rate exact
+    nextFrameTime += frameInterval;
+
+    // Fell more than a frame behind - skip missed slots instead of bursting
+    if ((long)(currentMicros - nextFrameTime) >= 0) {
+      unsigned long behind = currentMicros - nextFrameTime;
+      framesDropped += behind / frameInterval + 1;
+      nextFrameTime = currentMicros + frameInterval;
+    }
+
+    return true;
+  }
+
+  // Mark start/end of frame work for budget tracking
+  void beginFrame(unsigned long currentMicros) {
+    frameStartTime = currentMicros;
+  }
+
+  void endFrame(unsigned long currentMicros) {
+    lastFrameTime = currentMicros - frameStartTime;
+    totalFrameTime += lastFrameTime;
+    framesRendered++;
+
+    if (lastFrameTime > maxFrameTime) {
+      maxFrameTime = lastFrameTime;
+    }
+    if (lastFrameTime > frameInterval) {
+      framesOverBudget++;
+    }
+  }
+
+  // Time until the next frame is due (0 if already due)
+  unsigned long getTimeUntilNextFrame(unsigned long currentMicros) const {
+    if (!started || (long)(nextFrameTime - currentMicros) <= 0) return 0;
+    return nextFrameTime - currentMicros;
+  }
+
+  // Reset statistics (keeps the frame phase)
+  void resetStats() {
+    framesRendered = 0;
+    framesOverBudget = 0;
+    framesDropped = 0;
+    lastFrameTime = 0;
+    maxFrameTime = 0;
+    totalFrameTime = 0;
+  }
+
+  // Getters
+  unsigned long getFrameInterval() const { return frameInterval; }
+  unsigned long getFramesRendered() const { return framesRendered; }
+  unsigned long getFramesOverBudget() const { return framesOverBudget; }
+  unsigned long getFramesDropped() const { return framesDropped; }
+  unsigned long getLastFrameTime() const { return lastFrameTime; }
+  unsigned long getMaxFrameTime() const { return maxFrameTime; }
+  unsigned long getAverageFrameTime() const {
+    return framesRendered ? totalFrameTime / framesRendered : 0;
+  }
+
+  // Budget used by the last frame (0.0 - 1.0+)
+  float getBudgetUsage() const {
+    return (float)lastFrameTime / frameInterval;
+  }
+
+  // Print frame statistics
+  void printStats() const {
+    Serial.print("🎞️ Frames: ");
+    Serial.print(framesRendered);
+    Serial.print(" @ ");
+    Serial.print(getTargetFPS());
+    Serial.print(" FPS | avg ");
+    Serial.print(getAverageFrameTime());
+    Serial.print("us, max ");
+    Serial.print(maxFrameTime);
+    Serial.print("us / ");
+    Serial.print(frameInterval);
+    Serial.print("us budget | over: ");
+    Serial.print(framesOverBudget);
+    Serial.print(" | dropped: ");
+    Serial.println(framesDropped);
+  }
+};
+
+#endif // RENDER_SCHEDULER_H
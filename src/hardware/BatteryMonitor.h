@@ -129,12 +129,13 @@ public:
     return bar;
   }
 
-  // Display battery level on LED strip
-  void displayOnLEDs(LEDController& leds) const {
+  // Display battery level on LED strip (any LEDControllerT)
+  template <typename Leds>
+  void displayOnLEDs(Leds& leds) const {
     // Light up LEDs proportional to battery percentage
-    int ledsToLight = (percentage * HardwareConfig::NUM_LEDS) / 100;
+    int ledsToLight = (percentage * leds.getNumLeds()) / 100;
 
-    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    for (int i = 0; i < leds.getNumLeds(); i++) {
       if (i < ledsToLight) {
         // Green to yellow to red gradient
         if (percentage > 60) {
@@ -0,0 +1,289 @@
+#ifndef GYRO_CALIBRATION_H
+#define GYRO_CALIBRATION_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include "../config/Constants.h"
+
+// Gyro zero-rate offset, learned while the device is still
+// Samples are taken in blocks of CalibrationConfig::BLOCK_SAMPLES. In a block
+// where no gyro axis swings more than STILL_RANGE_DPS and |a| barely moves,
+// the device was at rest, so the block's mean rate is pure offset.
+// - Startup: STARTUP_BLOCKS still blocks in a row set the offset outright.
+//   Until then the offset saved by the previous run is used.
+// - Online: every later still block nudges the offset (time constant
+//   TRACKING_TIME_CONSTANT_S) to follow drift. A block further than
+//   MAX_TRACKING_STEP_DPS from the estimate is a slow steady turn, which the
+//   gyro alone cannot tell from rest, and is ignored.
+// - Temperature: each accepted block is also a (die temperature, offset)
+//   point in a least-squares line per axis, older points fading out. Once the
+//   points spread over MIN_TEMPERATURE_SPREAD_C the slope is applied, so the
+//   offset follows warm-up while the device is moving.
+// The result is saved to flash (Preferences) after the startup calibration,
+// then when it has moved, at most every SAVE_INTERVAL_MS.
+class GyroCalibration {
+public:
+  enum class State : uint8_t {
+    UNCALIBRATED,   // No offset yet (first boot, nothing saved)
+    STORED,         // Using the offset saved by a previous run
+    CALIBRATED      // Startup calibration done, tracking
+  };
+
+private:
+  // Temperatures enter the fit relative to this, keeping the float sums small
+  static constexpr float TEMPERATURE_ORIGIN_C = 25.0f;
+  static constexpr uint32_t STORED_VERSION = 1;
+
+  struct Stored {
+    uint32_t version;
+    float intercept[3];         // Offset at TEMPERATURE_ORIGIN_C, dps
+    float slope[3];             // dps per degree C
+  };
+
+  State state;
+  float intercept[3];
+  float slope[3];
+
+  // Current block
+  int blockCount;
+  float blockSum[3];
+  float blockMin[3];
+  float blockMax[3];
+  float accelMin;
+  float accelMax;
+  float temperatureSum;
+
+  // Startup: consecutive still blocks so far
+  int startupBlocks;
+  float startupSum[3];
+
+  // Temperature fit, exponentially weighted
+  float fitWeight;
+  float fitT;
+  float fitTT;
+  float fitG[3];
+  float fitTG[3];
+
+  unsigned long stillBlocks;
+  unsigned long rejectedBlocks;
+  unsigned long lastSave;
+  float savedIntercept[3];
+  bool saveRequested;
+
+public:
+  GyroCalibration() { reset(); }
+
+  // Forget everything learned (not the flash copy)
+  void reset() {
+    state = State::UNCALIBRATED;
+    for (int axis = 0; axis < 3; axis++) {
+      intercept[axis] = 0;
+      slope[axis] = 0;
+      savedIntercept[axis] = 0;
+      fitG[axis] = 0;
+      fitTG[axis] = 0;
+    }
+    fitWeight = 0;
+    fitT = 0;
+    fitTT = 0;
+    stillBlocks = 0;
+    rejectedBlocks = 0;
+    lastSave = 0;
+    saveRequested = false;
+    clearStartup();
+    startBlock();
+  }
+
+  // Offset saved by a previous run; false if there is none
+  bool load() {
+    Stored stored;
+    Preferences preferences;
+    preferences.begin(CalibrationConfig::PREFERENCES_NAMESPACE, true);
+    bool found = preferences.getBytesLength("offset") == sizeof(Stored) &&
+                 preferences.getBytes("offset", &stored, sizeof(Stored)) == sizeof(Stored) &&
+                 stored.version == STORED_VERSION;
+    preferences.end();
+    if (!found) return false;
+
+    for (int axis = 0; axis < 3; axis++) {
+      intercept[axis] = stored.intercept[axis];
+      slope[axis] = stored.slope[axis];
+      savedIntercept[axis] = stored.intercept[axis];
+    }
+    state = State::STORED;
+    return true;
+  }
+
+  void save(unsigned long currentTime) {
+    Stored stored;
+    stored.version = STORED_VERSION;
+    for (int axis = 0; axis < 3; axis++) {
+      stored.intercept[axis] = intercept[axis];
+      stored.slope[axis] = slope[axis];
+      savedIntercept[axis] = intercept[axis];
+    }
+    Preferences preferences;
+    preferences.begin(CalibrationConfig::PREFERENCES_NAMESPACE, false);
+    preferences.putBytes("offset", &stored, sizeof(Stored));
+    preferences.end();
+    lastSave = currentTime;
+    saveRequested = false;
+  }
+
+  // One raw sample: rates in dps, |a| in g, die temperature in degrees C
+  void update(float gx, float gy, float gz, float accelMagnitude, float temperature) {
+    const float rates[3] = {gx, gy, gz};
+    for (int axis = 0; axis < 3; axis++) {
+      blockSum[axis] += rates[axis];
+      blockMin[axis] = min(blockMin[axis], rates[axis]);
+      blockMax[axis] = max(blockMax[axis], rates[axis]);
+    }
+    accelMin = min(accelMin, accelMagnitude);
+    accelMax = max(accelMax, accelMagnitude);
+    temperatureSum += temperature;
+
+    if (++blockCount >= CalibrationConfig::BLOCK_SAMPLES) {
+      finishBlock();
+      startBlock();
+    }
+  }
+
+  // Saves when due; call from the task that owns the sensor
+  void saveIfDue(unsigned long currentTime) {
+    if (state != State::CALIBRATED) return;
+    if (!saveRequested) {
+      if (currentTime - lastSave < CalibrationConfig::SAVE_INTERVAL_MS) return;
+      float moved = 0;
+      for (int axis = 0; axis < 3; axis++) {
+        moved = max(moved, fabsf(intercept[axis] - savedIntercept[axis]));
+      }
+      if (moved < CalibrationConfig::SAVE_CHANGE_DPS) return;
+    }
+    save(currentTime);
+  }
+
+  // Offset at a die temperature, dps (subtract from the raw rate)
+  float getOffset(int axis, float temperature) const {
+    return intercept[axis] + slope[axis] * (temperature - TEMPERATURE_ORIGIN_C);
+  }
+
+  float getSlope(int axis) const { return slope[axis]; }
+  State getState() const { return state; }
+  bool isCalibrated() const { return state == State::CALIBRATED; }
+  unsigned long getStillBlocks() const { return stillBlocks; }
+  unsigned long getRejectedBlocks() const { return rejectedBlocks; }
+
+  void print(float temperature) const {
+    Serial.print("🧭 Gyro offset: ");
+    Serial.print(state == State::CALIBRATED ? "calibrated" : state == State::STORED ? "stored" : "none");
+    Serial.print(" | X=");
+    Serial.print(getOffset(0, temperature), 2);
+    Serial.print(" Y=");
+    Serial.print(getOffset(1, temperature), 2);
+    Serial.print(" Z=");
+    Serial.print(getOffset(2, temperature), 2);
+    Serial.print(" dps @ ");
+    Serial.print(temperature, 1);
+    Serial.print(" C | slope ");
+    Serial.print(slope[0], 3);
+    Serial.print("/");
+    Serial.print(slope[1], 3);
+    Serial.print("/");
+    Serial.print(slope[2], 3);
+    Serial.print(" dps/C | still blocks ");
+    Serial.print(stillBlocks);
+    Serial.print(" (");
+    Serial.print(rejectedBlocks);
+    Serial.println(" steady turns ignored)");
+  }
+
+private:
+  void clearStartup() {
+    startupBlocks = 0;
+    for (int axis = 0; axis < 3; axis++) startupSum[axis] = 0;
+  }
+
+  void startBlock() {
+    blockCount = 0;
+    for (int axis = 0; axis < 3; axis++) {
+      blockSum[axis] = 0;
+      blockMin[axis] = 1e9f;
+      blockMax[axis] = -1e9f;
+    }
+    accelMin = 1e9f;
+    accelMax = -1e9f;
+    temperatureSum = 0;
+  }
+
+  void finishBlock() {
+    bool still = accelMax - accelMin < CalibrationConfig::STILL_ACCEL_RANGE_G;
+    float mean[3];
+    for (int axis = 0; axis < 3; axis++) {
+      still = still && blockMax[axis] - blockMin[axis] < CalibrationConfig::STILL_RANGE_DPS;
+      mean[axis] = blockSum[axis] / blockCount;
+      still = still && fabsf(mean[axis]) < CalibrationConfig::MAX_OFFSET_DPS;
+    }
+    if (!still) {
+      if (state != State::CALIBRATED) clearStartup();
+      return;
+    }
+    float t = temperatureSum / blockCount - TEMPERATURE_ORIGIN_C;
+
+    // Startup: average STARTUP_BLOCKS still blocks in a row
+    if (state != State::CALIBRATED) {
+      for (int axis = 0; axis < 3; axis++) startupSum[axis] += mean[axis] - slope[axis] * t;
+      if (++startupBlocks >= CalibrationConfig::STARTUP_BLOCKS) {
+        for (int axis = 0; axis < 3; axis++) intercept[axis] = startupSum[axis] / startupBlocks;
+        state = State::CALIBRATED;
+        saveRequested = true;
+        Serial.println("🧭 Gyro calibrated");
+      }
+      stillBlocks++;
+      addFitPoint(t, mean);
+      return;
+    }
+
+    // Online: steady turns look still to the gyro; drift is slow
+    for (int axis = 0; axis < 3; axis++) {
+      if (fabsf(mean[axis] - (intercept[axis] + slope[axis] * t)) > CalibrationConfig::MAX_TRACKING_STEP_DPS) {
+        rejectedBlocks++;
+        return;
+      }
+    }
+    const float gain = (float)CalibrationConfig::BLOCK_SAMPLES / MPUConfig::SAMPLE_RATE_HZ /
+                       CalibrationConfig::TRACKING_TIME_CONSTANT_S;
+    for (int axis = 0; axis < 3; axis++) {
+      intercept[axis] += gain * (mean[axis] - slope[axis] * t - intercept[axis]);
+    }
+    stillBlocks++;
+    addFitPoint(t, mean);
+  }
+
+  void addFitPoint(float t, const float* mean) {
+    if (!CalibrationConfig::TEMPERATURE_MODEL) return;
+    const float keep = 1.0f - 1.0f / CalibrationConfig::TEMPERATURE_MEMORY_BLOCKS;
+    fitWeight = fitWeight * keep + 1;
+    fitT = fitT * keep + t;
+    fitTT = fitTT * keep + t * t;
+    for (int axis = 0; axis < 3; axis++) {
+      fitG[axis] = fitG[axis] * keep + mean[axis];
+      fitTG[axis] = fitTG[axis] * keep + t * mean[axis];
+    }
+
+    float meanT = fitT / fitWeight;
+    float spread = fitTT / fitWeight - meanT * meanT;
+    const float minSpread = CalibrationConfig::MIN_TEMPERATURE_SPREAD_C;
+    if (spread < minSpread * minSpread) return;
+
+    for (int axis = 0; axis < 3; axis++) {
+      float fitted = (fitTG[axis] / fitWeight - meanT * fitG[axis] / fitWeight) / spread;
+      float limited = constrain(fitted, -CalibrationConfig::MAX_SLOPE_DPS_PER_C,
+                                CalibrationConfig::MAX_SLOPE_DPS_PER_C);
+      // Keep the offset at this temperature where it is; only the slope moves
+      intercept[axis] += (slope[axis] - limited) * t;
+      slope[axis] = limited;
+    }
+  }
+};
+
+#endif // GYRO_CALIBRATION_H
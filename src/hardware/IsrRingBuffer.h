@@ -0,0 +1,70 @@
+#ifndef ISR_RING_BUFFER_H
+#define ISR_RING_BUFFER_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// Fixed-size single-producer/single-consumer ring buffer
+// Safe to push from an ISR while a task pops: each index is written by one
+// side only, and publishing uses release/acquire so the slot contents are
+// visible before the index moves. Capacity must be a power of two; one slot
+// is kept free to tell full from empty.
+template <typename T, int Capacity>
+class IsrRingBuffer {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                "IsrRingBuffer capacity must be a power of two");
+
+private:
+  static constexpr uint32_t MASK = Capacity - 1;
+
+  T slots[Capacity];
+  std::atomic<uint32_t> head;     // Next slot to write (producer)
+  std::atomic<uint32_t> tail;     // Next slot to read (consumer)
+  std::atomic<uint32_t> dropped;  // Pushes rejected because the buffer was full
+
+public:
+  IsrRingBuffer() : head(0), tail(0), dropped(0) {}
+
+  // Producer side (ISR): false if full
+  bool IRAM_ATTR push(const T& value) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    uint32_t next = (h + 1) & MASK;
+    if (next == tail.load(std::memory_order_acquire)) {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    slots[h] = value;
+    head.store(next, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side: false if empty
+  bool pop(T& value) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) {
+      return false;
+    }
+    value = slots[t];
+    tail.store((t + 1) & MASK, std::memory_order_release);
+    return true;
+  }
+
+  // Entries waiting for the consumer
+  int available() const {
+    uint32_t h = head.load(std::memory_order_acquire);
+    uint32_t t = tail.load(std::memory_order_acquire);
+    return (int)((h - t) & MASK);
+  }
+
+  bool isEmpty() const { return available() == 0; }
+
+  // Consumer side: discard everything queued so far
+  void clear() {
+    tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+  }
+
+  static constexpr int capacity() { return Capacity - 1; }
+  unsigned long getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+};
+
+#endif // ISR_RING_BUFFER_H
@@ -4,19 +4,103 @@
 #include <Arduino.h>
 #include <Adafruit_NeoPixel.h>
 #include "../config/Constants.h"
+#include "../config/StripGeometry.h"
+#include "../effects/ColorMath.h"
 
 // Wrapper class for NeoPixel LED strip control
-class LEDController {
+// Pixels are composed into a shadow frame buffer and only pushed to the strip
+// on show(). Each pixel is compared against the last latched frame, so show()
+// is skipped entirely when the frame is identical to what is already lit.
+// Templated on the pixel count so every per-pixel loop has a constant bound.
+//
+// Output stage (on by default): colors are also kept as 8.8 fixed point, run
+// through a gamma LUT and temporally dithered (per-channel error carry) into
+// 8-bit strip values, so dim fades below 1 LSB still move smoothly. While a
+// level sits between two output values the strip is latched on every show();
+// once the frame has been steady for EffectsConfig::DITHER_STEADY_FRAMES it
+// is latched one last time at the nearest 8-bit values (at least 1 for a lit
+// channel) and then left alone, so a static frame stops transmitting.
+template <int NumLeds>
+class LEDControllerT {
 private:
+  static constexpr int numLeds = StripGeometry<NumLeds>::COUNT;
+
   Adafruit_NeoPixel* strip;
-  int numLeds;
   float globalBrightness;
 
+  // Shadow frame buffer and the frame currently latched on the strip
+  uint32_t frameBuffer[NumLeds];
+  uint32_t latchedFrame[NumLeds];
+  bool pixelDirty[NumLeds];
+  int dirtyCount;      // Pixels that differ from the latched frame
+  bool forceLatch;     // Strip state changed outside the frame buffer
+
+  // Output stage: 8.8 working frame, gamma LUT and dither carry per channel
+  uint16_t fineFrame[NumLeds][3];
+  uint8_t ditherCarry[NumLeds][3];
+  uint32_t outputFrame[NumLeds];  // Dithered values last sent to the strip
+  uint16_t gammaTable[257];       // 8.8 in -> 8.8 out, sampled every 1.0
+  bool outputStage;
+  bool fineChanged;     // fineFrame changed below 8-bit resolution
+  bool ditherPending;   // Some channel sits between two output levels
+  int steadyFrames;     // Shows since the frame last changed
+
+  // Frame statistics
+  unsigned long framesSubmitted;
+  unsigned long framesTransmitted;
+  unsigned long pixelsTransmitted;
+
+  // Write a pixel into the shadow buffer and update its dirty state
+  void writePixel(int led, uint32_t color) {
+    writePixelFine(led, color,
+                   (uint16_t)(ColorMath::red(color) << 8),
+                   (uint16_t)(ColorMath::green(color) << 8),
+                   (uint16_t)(ColorMath::blue(color) << 8));
+  }
+
+  void writePixelFine(int led, uint32_t color, uint16_t r, uint16_t g, uint16_t b) {
+    uint16_t* fine = fineFrame[led];
+    if (fine[0] != r || fine[1] != g || fine[2] != b) {
+      fine[0] = r;
+      fine[1] = g;
+      fine[2] = b;
+      fineChanged = true;
+    }
+
+    frameBuffer[led] = color;
+
+    bool dirty = (color != latchedFrame[led]);
+    if (dirty != pixelDirty[led]) {
+      pixelDirty[led] = dirty;
+      dirtyCount += dirty ? 1 : -1;
+    }
+  }
+
 public:
-  LEDController(Adafruit_NeoPixel* stripPtr)
+  LEDControllerT(Adafruit_NeoPixel* stripPtr)
     : strip(stripPtr),
-      numLeds(HardwareConfig::NUM_LEDS),
-      globalBrightness(0.6f) {}
+      globalBrightness(0.6f),
+      dirtyCount(0),
+      forceLatch(true),
+      outputStage(true),
+      fineChanged(false),
+      ditherPending(false),
+      steadyFrames(0),
+      framesSubmitted(0),
+      framesTransmitted(0),
+      pixelsTransmitted(0) {
+    for (int i = 0; i < NumLeds; i++) {
+      frameBuffer[i] = 0;
+      latchedFrame[i] = 0;
+      outputFrame[i] = 0;
+      pixelDirty[i] = false;
+      for (int c = 0; c < 3; c++) {
+        fineFrame[i][c] = 0;
+        ditherCarry[i][c] = 0;
+      }
+    }
+    setGamma(EffectsConfig::OUTPUT_GAMMA);
+  }
 
   // Initialize LED strip
   void begin() {
@@ -27,9 +111,150 @@ public:
     Serial.println("💡 LED strip initialized");
   }
 
-  // Update LED display
+  // Submit the frame; transmits only if any pixel differs from the latched frame
   void show() {
+    framesSubmitted++;
+
+    if (outputStage) {
+      showThroughOutputStage();
+      return;
+    }
+
+    if (dirtyCount == 0 && !forceLatch) {
+      return;
+    }
+
+    // Copy changed pixels into the driver buffer
+    for (int i = 0; i < numLeds; i++) {
+      if (pixelDirty[i] || forceLatch) {
+        strip->setPixelColor(i, frameBuffer[i]);
+        latchedFrame[i] = frameBuffer[i];
+        pixelDirty[i] = false;
+        pixelsTransmitted++;
+      }
+    }
+
     strip->show();
+    framesTransmitted++;
+    dirtyCount = 0;
+    forceLatch = false;
+  }
+
+  // Gamma + temporal dither, then latch if any strip value changed
+  void showThroughOutputStage() {
+    if (dirtyCount == 0 && !fineChanged && !ditherPending && !forceLatch) {
+      return;
+    }
+
+    bool changed = forceLatch;
+    steadyFrames = (dirtyCount > 0 || fineChanged) ? 0 : steadyFrames + 1;
+    bool settle = steadyFrames >= EffectsConfig::DITHER_STEADY_FRAMES;
+    ditherPending = false;
+
+    for (int i = 0; i < numLeds; i++) {
+      uint8_t out[3];
+      for (int c = 0; c < 3; c++) {
+        // Interpolated gamma lookup, then carry the sub-LSB remainder forward
+        uint16_t value = fineFrame[i][c];
+        uint16_t low = gammaTable[value >> 8];
+        uint16_t high = gammaTable[(value >> 8) + 1];
+        uint32_t linear = low + (((uint32_t)(high - low) * (value & 0xFF)) >> 8);
+
+        if (settle) {
+          // Steady long enough: nearest value, no carry left to pay out.
+          // A lit channel never settles to dark.
+          uint32_t nearest = (linear + 0x80) >> 8;  // linear <= 65280
+          out[c] = (uint8_t)((nearest == 0 && linear > 0) ? 1 : nearest);
+          ditherCarry[i][c] = 0;
+          continue;
+        }
+
+        uint32_t total = linear + ditherCarry[i][c];  // <= 65280 + 255
+        out[c] = (uint8_t)(total >> 8);
+        ditherCarry[i][c] = total & 0xFF;
+        if (linear & 0xFF) ditherPending = true;
+      }
+
+      uint32_t color = ColorMath::pack(out[0], out[1], out[2]);
+      if (color != outputFrame[i] || forceLatch) {
+        strip->setPixelColor(i, color);
+        outputFrame[i] = color;
+        pixelsTransmitted++;
+        changed = true;
+      }
+
+      latchedFrame[i] = frameBuffer[i];
+      pixelDirty[i] = false;
+    }
+
+    if (changed) {
+      strip->show();
+      framesTransmitted++;
+    }
+    dirtyCount = 0;
+    fineChanged = false;
+    forceLatch = false;
+  }
+
+  // Rebuild the gamma LUT (1.0 = linear)
+  void setGamma(float gamma) {
+    for (int i = 0; i <= 256; i++) {
+      float input = min(i, 255) / 255.0f;
+      gammaTable[i] = (uint16_t)(powf(input, gamma) * 65280.0f + 0.5f);
+    }
+    forceLatch = true;
+  }
+
+  // Enable/disable gamma + dithering (off = 8-bit frame sent as-is)
+  void setOutputStage(bool enabled) {
+    if (enabled != outputStage) {
+      outputStage = enabled;
+      forceLatch = true;
+    }
+  }
+
+  bool isOutputStageEnabled() const { return outputStage; }
+
+  // Latch the frame even if unchanged
+  void forceShow() {
+    forceLatch = true;
+    show();
+  }
+
+  // Frame differs from what is on the strip (or is still dithering toward it)
+  bool isDirty() const {
+    return dirtyCount > 0 || forceLatch || (outputStage && (fineChanged || ditherPending));
+  }
+
+  // Check if a single pixel changed since the last latch
+  bool isPixelDirty(int led) const {
+    return led >= 0 && led < numLeds && pixelDirty[led];
+  }
+
+  int getDirtyPixelCount() const { return dirtyCount; }
+
+  // Frame statistics
+  unsigned long getFramesSubmitted() const { return framesSubmitted; }
+  unsigned long getFramesTransmitted() const { return framesTransmitted; }
+  unsigned long getFramesSkipped() const { return framesSubmitted - framesTransmitted; }
+  unsigned long getPixelsTransmitted() const { return pixelsTransmitted; }
+
+  void resetStats() {
+    framesSubmitted = 0;
+    framesTransmitted = 0;
+    pixelsTransmitted = 0;
+  }
+
+  void printStats() const {
+    Serial.print("💡 LED frames: ");
+    Serial.print(framesSubmitted);
+    Serial.print(" submitted, ");
+    Serial.print(framesTransmitted);
+    Serial.print(" transmitted (");
+    Serial.print(framesSubmitted ? 100.0f * getFramesSkipped() / framesSubmitted : 0.0f, 1);
+    Serial.print("% skipped) | changed pixels: ");
+    Serial.print(pixelsTransmitted);
+    Serial.println(outputStage ? " | gamma + dither" : " | 8-bit direct");
   }
 
   // Set global brightness
@@ -43,67 +268,57 @@ public:
 
   // Clear all LEDs
   void clear() {
-    strip->clear();
+    fill(0);
   }
 
   // Set LED color using RGB (0-255 range)
   void setColorRGB(int led, uint8_t r, uint8_t g, uint8_t b) {
     if (led >= 0 && led < numLeds) {
-      strip->setPixelColor(led, strip->Color(r, g, b));
+      writePixel(led, strip->Color(r, g, b));
     }
   }
 
-  // Set LED color using HSV
+  // Set LED color using HSV (full saturation, hue from the shared wheel table)
   // hue: 0.0-1.0 (full color wheel)
   // brightness: 0.0-1.0
   void setColorHSV(int led, float hue, float brightness) {
     if (led < 0 || led >= numLeds) return;
 
-    // Clamp values
-    hue = constrain(hue, 0.0, 1.0);
-    brightness = constrain(brightness, 0.0, 1.0);
-
-    // Convert HSV to RGB
-    float h = hue * 6.0;
-    float s = 1.0;  // Full saturation
-    float v = brightness;
-
-    float c = v * s;
-    float x = c * (1.0 - abs(fmod(h, 2.0) - 1.0));
-    float m = v - c;
-
-    float r, g, b;
-    if (h < 1.0)      { r = c; g = x; b = 0; }
-    else if (h < 2.0) { r = x; g = c; b = 0; }
-    else if (h < 3.0) { r = 0; g = c; b = x; }
-    else if (h < 4.0) { r = 0; g = x; b = c; }
-    else if (h < 5.0) { r = x; g = 0; b = c; }
-    else              { r = c; g = 0; b = x; }
-
-    setColorRGB(led,
-                (uint8_t)((r + m) * 255),
-                (uint8_t)((g + m) * 255),
-                (uint8_t)((b + m) * 255));
+    uint32_t color = ColorMath::hueToRgb(ColorMath::hueFromFraction(hue));
+    setColorScaled(led, color, ColorMath::levelFromFloat(brightness));
   }
 
   // Set LED color using uint32_t packed color
   void setColor(int led, uint32_t color) {
     if (led >= 0 && led < numLeds) {
-      strip->setPixelColor(led, color);
+      writePixel(led, color);
     }
   }
 
-  // Get LED color
+  // Set LED color scaled by a brightness level, keeping the sub-LSB part
+  // for the output stage
+  void setColorScaled(int led, uint32_t color, ColorMath::Level level) {
+    if (led < 0 || led >= numLeds) return;
+
+    writePixelFine(led, ColorMath::scaleColor(color, level),
+                   ColorMath::scaleChannel16(ColorMath::red(color), level),
+                   ColorMath::scaleChannel16(ColorMath::green(color), level),
+                   ColorMath::scaleChannel16(ColorMath::blue(color), level));
+  }
+
+  // Get LED color (as composed, before the output stage)
   uint32_t getColor(int led) const {
     if (led >= 0 && led < numLeds) {
-      return strip->getPixelColor(led);
+      return frameBuffer[led];
     }
     return 0;
   }
 
   // Set all LEDs to same color
   void fill(uint32_t color) {
-    strip->fill(color);
+    for (int i = 0; i < numLeds; i++) {
+      writePixel(i, color);
+    }
   }
 
   void fillRGB(uint8_t r, uint8_t g, uint8_t b) {
@@ -113,10 +328,11 @@ public:
   // Set brightness multiplier (0-255)
   void setBrightness(uint8_t brightness) {
     strip->setBrightness(brightness);
+    forceLatch = true;
   }
 
   // Get number of LEDs
-  int getNumLeds() const {
+  static constexpr int getNumLeds() {
     return numLeds;
   }
 
@@ -182,4 +398,7 @@ public:
   }
 };
 
+// Controller for the strip this firmware is built for
+using LEDController = LEDControllerT<HardwareConfig::NUM_LEDS>;
+
 #endif // LED_CONTROLLER_H
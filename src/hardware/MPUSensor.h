@@ -3,28 +3,254 @@
 
 #include <Arduino.h>
 #include <Wire.h>
+#include <functional>
 #include "../config/Constants.h"
+#include "IsrRingBuffer.h"
+#include "OrientationFilter.h"
+#include "GyroCalibration.h"
 
 // MPU-6050 Accelerometer and Gyroscope sensor wrapper
+// The sensor samples into its on-chip FIFO at MPUConfig::SAMPLE_RATE_HZ;
+// read() drains it in I2C bursts and hands every sample (oldest first) to the
+// sample callback, so nothing between two reads is lost.
+// Each sample also raises the INT pin (data ready); the ISR queues a micros()
+// timestamp that read() pairs with the sample, so sample times do not depend
+// on when the sensor task gets around to draining.
+// Every sample also steps the orientation filter by the time since the
+// previous sample's timestamp, so angles do not depend on the sample rate or
+// the sensor's oscillator; tiltAngle comes from its gravity estimate rather
+// than the raw accelerometer. Gyro rates are
+// delivered with the calibrated zero-rate offset removed; the die temperature
+// (read once per MPUConfig::TEMPERATURE_INTERVAL_MS) feeds its model.
+//
+// The bus runs at MPUConfig::I2C_CLOCK_HZ. The firmware's sensor task calls
+// the blocking read(): rendering has its own task and runs while this one
+// waits on I2C, which replaced draining in phases from a shared loop. The
+// phases read() is built from stay public for the host bench, whose
+// single-loop simulation still interleaves frames with a drain:
+//   startRead()  - read the FIFO count (one short transaction)
+//   poll()       - transfer and deliver one burst; true once all are done
+//   completeRead() - finish, returns the number of samples delivered
+// Time spent blocked inside Wire calls is accumulated and reported per second.
 class MPUSensor {
+public:
+  // Called per sample with the public fields set to that sample
+  typedef std::function<void(MPUSensor&, unsigned long)> SampleCallback;
+
+  // Register map
+  static constexpr byte REG_SMPLRT_DIV = 0x19;
+  static constexpr byte REG_CONFIG = 0x1A;
+  static constexpr byte REG_FIFO_EN = 0x23;
+  static constexpr byte REG_TEMP_OUT_H = 0x41;
+  static constexpr byte REG_INT_PIN_CFG = 0x37;
+  static constexpr byte REG_INT_ENABLE = 0x38;
+  static constexpr byte REG_USER_CTRL = 0x6A;
+  static constexpr byte REG_PWR_MGMT_1 = 0x6B;
+  static constexpr byte REG_FIFO_COUNT_H = 0x72;
+  static constexpr byte REG_FIFO_R_W = 0x74;
+
+  static constexpr byte FIFO_EN_GYRO = 0x70;       // XG, YG, ZG
+  static constexpr byte FIFO_EN_ACCEL = 0x08;
+  static constexpr byte USER_CTRL_FIFO_EN = 0x40;
+  static constexpr byte USER_CTRL_FIFO_RESET = 0x04;
+  static constexpr byte INT_ENABLE_DATA_RDY = 0x01;
+
+  static constexpr int FIFO_SIZE = 1024;
+  static constexpr int FIFO_SAMPLE_BYTES = 12;     // Accel XYZ + gyro XYZ
+  static constexpr unsigned long SAMPLE_PERIOD_MS = 1000 / MPUConfig::SAMPLE_RATE_HZ;
+
 private:
+  enum class ReadPhase {
+    IDLE,       // No drain in progress
+    BURSTING,   // Count read, bursts left to transfer
+    COMPLETE    // All samples delivered, waiting for completeRead()
+  };
+
   byte address;
   bool available;
+  int interruptPin;
+  SampleCallback onSample;
+  unsigned long lastReadTime;
+
+  // Drain in progress
+  ReadPhase phase;
+  int queued;              // Samples in the FIFO when the count was read
+  int samples;             // Samples this drain will deliver
+  int untimed;             // Oldest samples without an interrupt timestamp
+  int delivered;
+  unsigned long drainMillis;
+  unsigned long drainMicros;
+
+  // Data-ready timestamps (micros) queued by the ISR, one per FIFO sample
+  IsrRingBuffer<unsigned long, MPUConfig::TIMESTAMP_QUEUE_SIZE> sampleTimes;
+
+  // Filter time step: gap between consecutive interrupt timestamps
+  unsigned long lastTimedMicros;   // Previous sample's timestamp
+  bool lastSampleTimed;            // Previous sample had an interrupt timestamp
+  float sampleInterval;            // Step of the current sample, seconds
+
+  // Gravity/rotation estimate, stepped once per delivered sample
+  OrientationFilter orientation;
+
+  // Gyro offset (calibrated at rest) and the die temperature it depends on
+  GyroCalibration calibration;
+
+  // FIFO statistics
+  unsigned long samplesRead;
+  unsigned long bursts;
+  unsigned long overflows;
+  unsigned long untimedSamples;  // Samples without a queued interrupt timestamp
+
+  // I2C blocking statistics (1 s windows)
+  unsigned long busWindowStart;
+  unsigned long busBlockedInWindow;    // us blocked in Wire calls this window
+  unsigned long busLongestInWindow;    // Longest single phase this window
+  unsigned long busBlockedPerSecond;   // Last completed window
+  unsigned long busLongestStep;        // Last completed window
+
+  unsigned long lastTemperatureRead;
+
+  static void IRAM_ATTR onDataReady(void* arg) {
+    static_cast<MPUSensor*>(arg)->sampleTimes.push(micros());
+  }
+
+  void writeRegister(byte reg, byte value) {
+    Wire.beginTransmission(address);
+    Wire.write(reg);
+    Wire.write(value);
+    Wire.endTransmission();
+  }
+
+  int readRegisters(byte reg, uint8_t* buffer, int count) {
+    Wire.beginTransmission(address);
+    Wire.write(reg);
+    Wire.endTransmission(false);
+    Wire.requestFrom(address, (byte)count);
+
+    int received = 0;
+    while (received < count && Wire.available()) {
+      buffer[received++] = Wire.read();
+    }
+    return received;
+  }
+
+  // Timed readRegisters() for the drain phases
+  int readRegistersTimed(byte reg, uint8_t* buffer, int count) {
+    unsigned long start = micros();
+    int received = readRegisters(reg, buffer, count);
+    recordBusTime(micros() - start);
+    return received;
+  }
+
+  void recordBusTime(unsigned long blocked) {
+    unsigned long now = millis();
+    if (now - busWindowStart >= 1000) {
+      unsigned long elapsed = now - busWindowStart;
+      busBlockedPerSecond = elapsed < 2000 ? busBlockedInWindow * 1000UL / elapsed : 0;
+      busLongestStep = busLongestInWindow;
+      busWindowStart = now;
+      busBlockedInWindow = 0;
+      busLongestInWindow = 0;
+    }
+    busBlockedInWindow += blocked;
+    if (blocked > busLongestInWindow) busLongestInWindow = blocked;
+  }
+
+  void configureFifo() {
+    writeRegister(REG_CONFIG, MPUConfig::DLPF_CONFIG);
+    writeRegister(REG_SMPLRT_DIV, 1000 / MPUConfig::SAMPLE_RATE_HZ - 1);  // 1 kHz / (1 + div)
+    writeRegister(REG_FIFO_EN, FIFO_EN_ACCEL | FIFO_EN_GYRO);
+    resetFifo();
+  }
+
+  void resetFifo() {
+    writeRegister(REG_USER_CTRL, USER_CTRL_FIFO_RESET);
+    sampleTimes.clear();
+    lastSampleTimed = false;
+    writeRegister(REG_USER_CTRL, USER_CTRL_FIFO_EN);
+  }
+
+  // Data-ready pulse (50 us, active high) on INT for every sample
+  void enableDataReadyInterrupt() {
+    if (interruptPin < 0) return;
+    pinMode(interruptPin, INPUT);
+    attachInterruptArg(digitalPinToInterrupt(interruptPin), onDataReady, this, RISING);
+    writeRegister(REG_INT_PIN_CFG, 0x00);
+    writeRegister(REG_INT_ENABLE, INT_ENABLE_DATA_RDY);
+  }
+
+  // Decode one FIFO record into the public fields
+  void decodeSample(const uint8_t* data) {
+    int16_t rawX = data[0] << 8 | data[1];
+    int16_t rawY = data[2] << 8 | data[3];
+    int16_t rawZ = data[4] << 8 | data[5];
+    int16_t rawGX = data[6] << 8 | data[7];
+    int16_t rawGY = data[8] << 8 | data[9];
+    int16_t rawGZ = data[10] << 8 | data[11];
+
+    // Convert to g's (±2g range = 16384 LSB/g)
+    setAccel(rawX / 16384.0f, rawY / 16384.0f, rawZ / 16384.0f);
+
+    // Convert to degrees/second (±250°/s range = 131 LSB/°/s)
+    gyroX = rawGX / 131.0;
+    gyroY = rawGY / 131.0;
+    gyroZ = rawGZ / 131.0;
+  }
+
+  void readTemperature() {
+    uint8_t raw[2];
+    if (readRegistersTimed(REG_TEMP_OUT_H, raw, 2) < 2) return;
+    temperature = (int16_t)(raw[0] << 8 | raw[1]) / 340.0f + 36.53f;  // Datasheet formula
+    lastTemperatureRead = millis();
+  }
 
 public:
   // Sensor data (public for easy access)
   float accelX = 0;
   float accelY = 0;
   float accelZ = 0;
+  float accelMagnitude = 0;  // |accel| of the current sample, set with it
   float gyroX = 0;
+  float gyroY = 0;
   float gyroZ = 0;
-  float tiltAngle = 0;  // Normalized -1.0 (down) to 1.0 (up)
+  float tiltAngle = 0;  // Normalized -1.0 (down) to 1.0 (up), filtered
+  float temperature = 25;  // Die temperature, degrees C
+  unsigned long sampleMicros = 0;  // Capture time of the current sample
+
+  MPUSensor(int intPin = HardwareConfig::MPU_INT_PIN)
+    : address(MPUConfig::MPU_ADDRESS),
+      available(false),
+      interruptPin(intPin),
+      lastReadTime(0),
+      phase(ReadPhase::IDLE),
+      queued(0),
+      samples(0),
+      untimed(0),
+      delivered(0),
+      drainMillis(0),
+      drainMicros(0),
+      lastTimedMicros(0),
+      lastSampleTimed(false),
+      sampleInterval(SAMPLE_PERIOD_MS / 1000.0f),
+      samplesRead(0),
+      bursts(0),
+      overflows(0),
+      untimedSamples(0),
+      busWindowStart(0),
+      busBlockedInWindow(0),
+      busLongestInWindow(0),
+      busBlockedPerSecond(0),
+      busLongestStep(0),
+      lastTemperatureRead(0) {}
 
-  MPUSensor() : address(MPUConfig::MPU_ADDRESS), available(false) {}
+  void setOnSample(SampleCallback callback) {
+    onSample = callback;
+  }
 
   // Initialize MPU-6050 sensor
   bool begin() {
     Wire.begin();
+    Wire.setClock(MPUConfig::I2C_CLOCK_HZ);
     delay(MPUConfig::INIT_DELAY_MS);
     Serial.println("🔍 Connecting to MPU-6050...");
 
@@ -37,16 +263,18 @@ public:
       available = true;
 
       // Wake up MPU-6050 (register 0x6B, value 0x00)
-      Wire.beginTransmission(address);
-      Wire.write(0x6B);
-      Wire.write(0x00);
-      Wire.endTransmission();
+      writeRegister(REG_PWR_MGMT_1, 0x00);
 
       // Set accelerometer range to ±2g (register 0x1C, value 0x00)
-      Wire.beginTransmission(address);
-      Wire.write(0x1C);
-      Wire.write(0x00);
-      Wire.endTransmission();
+      writeRegister(0x1C, 0x00);
+
+      // Gyro offset from the previous run until the startup calibration
+      calibration.load();
+      readTemperature();
+
+      // Sample into the FIFO at a fixed rate, data-ready on INT
+      configureFifo();
+      enableDataReadyInterrupt();
 
       return true;
     } else {
@@ -61,48 +289,140 @@ public:
     return available;
   }
 
-  // Read all sensor data
-  void read() {
-    if (!available) return;
+  // Drain due: enough data-ready interrupts queued, or the fallback interval
+  // passed (INT not wired / missed pulses)
+  bool isReadDue(unsigned long currentTime) const {
+    if (!available) return false;
+    return sampleTimes.available() >= MPUConfig::FIFO_DRAIN_SAMPLES ||
+           currentTime - lastReadTime >= (unsigned long)MPUConfig::READ_INTERVAL_MS;
+  }
 
-    Wire.beginTransmission(address);
-    Wire.write(0x3B);  // Starting register for accel data
-    Wire.endTransmission(false);
-    Wire.requestFrom(address, (byte)14);  // Read accel + temp + gyro
-
-    if (Wire.available() >= 14) {
-      // Read accelerometer (6 bytes)
-      int16_t rawX = Wire.read() << 8 | Wire.read();
-      int16_t rawY = Wire.read() << 8 | Wire.read();
-      int16_t rawZ = Wire.read() << 8 | Wire.read();
-
-      // Skip temperature (2 bytes)
-      Wire.read();
-      Wire.read();
-
-      // Read gyroscope (6 bytes)
-      int16_t rawGX = Wire.read() << 8 | Wire.read();
-      Wire.read(); Wire.read();  // Skip gyroY
-      int16_t rawGZ = Wire.read() << 8 | Wire.read();
-
-      // Convert to g's (±2g range = 16384 LSB/g)
-      accelX = rawX / 16384.0;
-      accelY = rawY / 16384.0;
-      accelZ = rawZ / 16384.0;
-
-      // Convert to degrees/second (±250°/s range = 131 LSB/°/s)
-      gyroX = rawGX / 131.0;
-      gyroZ = rawGZ / 131.0;
-
-      // Calculate tilt angle (normalized to -1.0 to 1.0)
-      // Using X-axis acceleration (assumes upright orientation)
-      tiltAngle = constrain(accelX, -1.0, 1.0);
+  bool isReadInProgress() const {
+    return phase != ReadPhase::IDLE;
+  }
+
+  // Phase 1: read the FIFO count; false if there is nothing to transfer
+  bool startRead() {
+    if (!available || phase != ReadPhase::IDLE) return false;
+    lastReadTime = millis();
+    if (lastReadTime - lastTemperatureRead >= MPUConfig::TEMPERATURE_INTERVAL_MS) readTemperature();
+
+    uint8_t countBytes[2];
+    if (readRegistersTimed(REG_FIFO_COUNT_H, countBytes, 2) < 2) return false;
+    int pending = (countBytes[0] << 8) | countBytes[1];
+
+    // A full FIFO has overwritten old data and may be misaligned
+    if (pending >= FIFO_SIZE) {
+      overflows++;
+      Serial.println("⚠️ MPU FIFO overflow - resetting");
+      resetFifo();
+      return false;
     }
+
+    queued = pending / FIFO_SAMPLE_BYTES;
+    samples = min(queued, MPUConfig::FIFO_MAX_SAMPLES_PER_READ);
+    delivered = 0;
+    drainMillis = millis();
+    drainMicros = micros();
+
+    // One pulse per sample, both in order. Pulses can only run ahead of the
+    // count (samples landing after it was read); fewer pulses than samples
+    // means some were missed, and the oldest samples go untimed
+    untimed = max(0, queued - sampleTimes.available());
+
+    phase = samples > 0 ? ReadPhase::BURSTING : ReadPhase::COMPLETE;
+    return samples > 0;
+  }
+
+  // Phase 2: transfer one burst and deliver its samples; true when done
+  bool poll() {
+    if (phase != ReadPhase::BURSTING) return phase == ReadPhase::COMPLETE;
+
+    uint8_t buffer[MPUConfig::FIFO_BURST_SAMPLES * FIFO_SAMPLE_BYTES];
+    int batch = min(samples - delivered, MPUConfig::FIFO_BURST_SAMPLES);
+    int bytes = batch * FIFO_SAMPLE_BYTES;
+    if (readRegistersTimed(REG_FIFO_R_W, buffer, bytes) < bytes) {
+      phase = ReadPhase::COMPLETE;
+      return true;
+    }
+    bursts++;
+
+    for (int i = 0; i < batch; i++) {
+      decodeSample(buffer + i * FIFO_SAMPLE_BYTES);
+
+      // Untimed: assume the newest sample is "now", older ones one period apart
+      bool timed = delivered >= untimed && sampleTimes.pop(sampleMicros);
+      if (!timed) {
+        sampleMicros = drainMicros - (unsigned long)(queued - 1 - delivered) * SAMPLE_PERIOD_MS * 1000UL;
+        untimedSamples++;
+      }
+      delivered++;
+
+      // Measured step between two interrupt timestamps; the nominal period
+      // after an untimed sample, a FIFO reset or a gap of lost samples
+      unsigned long gap = sampleMicros - lastTimedMicros;
+      sampleInterval = timed && lastSampleTimed && gap > 0 && gap <= MPUConfig::MAX_SAMPLE_GAP_US
+                       ? gap / 1000000.0f : SAMPLE_PERIOD_MS / 1000.0f;
+      lastTimedMicros = sampleMicros;
+      lastSampleTimed = timed;
+
+      calibration.update(gyroX, gyroY, gyroZ, accelMagnitude, temperature);
+      gyroX -= calibration.getOffset(0, temperature);
+      gyroY -= calibration.getOffset(1, temperature);
+      gyroZ -= calibration.getOffset(2, temperature);
+
+      orientation.update(accelX, accelY, accelZ, accelMagnitude, gyroX, gyroY, gyroZ, sampleInterval);
+      tiltAngle = orientation.getTilt();
+
+      if (onSample) {
+        onSample(*this, drainMillis - (drainMicros - sampleMicros) / 1000UL);
+      }
+    }
+
+    if (delivered >= samples) phase = ReadPhase::COMPLETE;
+    return phase == ReadPhase::COMPLETE;
+  }
+
+  // Phase 3: returns the number of samples delivered by this drain
+  int completeRead() {
+    if (phase == ReadPhase::IDLE) return 0;
+    phase = ReadPhase::IDLE;
+    samplesRead += delivered;
+    calibration.saveIfDue(millis());
+    return delivered;
+  }
+
+  // Blocking drain (all phases); returns the number of samples delivered
+  int read() {
+    if (!startRead()) return completeRead();
+    while (!poll()) {}
+    return completeRead();
+  }
+
+  // FIFO statistics
+  unsigned long getSamplesRead() const { return samplesRead; }
+  unsigned long getBurstCount() const { return bursts; }
+  unsigned long getOverflowCount() const { return overflows; }
+  unsigned long getUntimedSampleCount() const { return untimedSamples; }
+  unsigned long getDroppedTimestampCount() const { return sampleTimes.getDroppedCount(); }
+  int getPendingInterrupts() const { return sampleTimes.available(); }
+
+  // I2C statistics (last full second)
+  unsigned long getBusBlockedMicrosPerSecond() const { return busBlockedPerSecond; }
+  unsigned long getLongestBusStepMicros() const { return busLongestStep; }
+
+  // Set the acceleration (g) and its magnitude, computed once per sample
+  // and shared by calibration, the orientation filter and gestures
+  void setAccel(float x, float y, float z) {
+    accelX = x;
+    accelY = y;
+    accelZ = z;
+    accelMagnitude = sqrtf(x * x + y * y + z * z);
   }
 
   // Get total acceleration magnitude
   float getAccelMagnitude() const {
-    return sqrt(accelX * accelX + accelY * accelY + accelZ * accelZ);
+    return accelMagnitude;
   }
 
   // Get motion delta (for movement detection)
@@ -115,8 +435,17 @@ public:
   float getAccelY() const { return accelY; }
   float getAccelZ() const { return accelZ; }
   float getGyroX() const { return gyroX; }
+  float getGyroY() const { return gyroY; }
   float getGyroZ() const { return gyroZ; }
   float getTiltAngle() const { return tiltAngle; }
+  float getTemperature() const { return temperature; }
+  float getSampleInterval() const { return sampleInterval; }  // Filter step, seconds
+  const GyroCalibration& getCalibration() const { return calibration; }
+
+  // Fused orientation (degrees); rotations are the unwrapped gyro integrals
+  const OrientationFilter& getOrientation() const { return orientation; }
+  float getRotationX() const { return orientation.getRotationX(); }
+  float getRotationZ() const { return orientation.getRotationZ(); }
 
   // Check if rotating on X-axis (barrel roll detection)
   bool isRotatingX() const {
@@ -138,10 +467,39 @@ public:
     Serial.print(accelZ, 2);
     Serial.print(" | Gyro: X=");
     Serial.print(gyroX, 1);
+    Serial.print(" Y=");
+    Serial.print(gyroY, 1);
     Serial.print(" Z=");
     Serial.print(gyroZ, 1);
     Serial.print(" | Tilt=");
-    Serial.println(tiltAngle, 2);
+    Serial.print(tiltAngle, 2);
+    Serial.print(" | Roll/Pitch/Yaw=");
+    Serial.print(orientation.getRoll(), 1);
+    Serial.print("/");
+    Serial.print(orientation.getPitch(), 1);
+    Serial.print("/");
+    Serial.print(orientation.getYaw(), 1);
+    Serial.print(" | Step ");
+    Serial.print(sampleInterval * 1000.0f, 2);
+    Serial.print(" ms | FIFO: ");
+    Serial.print(samplesRead);
+    Serial.print(" samples, ");
+    Serial.print(bursts);
+    Serial.print(" bursts, ");
+    Serial.print(overflows);
+    Serial.print(" overflows, ");
+    Serial.print(untimedSamples);
+    Serial.println(" untimed");
+  }
+
+  void printBusStats() const {
+    Serial.print("🔌 I2C @ ");
+    Serial.print(MPUConfig::I2C_CLOCK_HZ / 1000);
+    Serial.print(" kHz | blocked ");
+    Serial.print(busBlockedPerSecond);
+    Serial.print(" us/s | longest step ");
+    Serial.print(busLongestStep);
+    Serial.println(" us");
   }
 };
 
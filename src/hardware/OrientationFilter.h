@@ -0,0 +1,107 @@
+#ifndef ORIENTATION_FILTER_H
+#define ORIENTATION_FILTER_H
+
+#include <Arduino.h>
+#include "../config/Constants.h"
+
+// Orientation from gyro + accelerometer (complementary filter)
+// Tracks the "up" direction as a unit vector in sensor coordinates. Each
+// sample the gyro rotates it (small-angle step), then it is pulled a little
+// toward the measured acceleration: the gyro is trusted over short horizons,
+// so a jerk of the hand barely moves it, and gravity over long ones, so gyro
+// drift stays bounded. Readings far from 1 g (taps, free fall) are skipped.
+// The correction is deliberately not weighted by how close the reading is to
+// 1 g: shaking pushes the magnitude both ways, and trusting only one side of
+// it biases the estimate.
+// Multiply-adds and two square roots per sample, no trig; roll and pitch are
+// only derived (atan2) when asked for.
+class OrientationFilter {
+private:
+  static constexpr float RADIANS_PER_DEGREE = 0.017453293f;
+  static constexpr float DEGREES_PER_RADIAN = 57.29578f;
+
+  float upX, upY, upZ;
+  float yaw;                     // Degrees about "up" (gyro only: drifts, no magnetometer)
+  float rotationX;               // Gyro integral about the sensor X axis, degrees, unwrapped
+  float rotationZ;               // Same about Z
+  bool initialized;              // "up" seeded from the first usable accel sample
+
+public:
+  OrientationFilter() { reset(); }
+
+  void reset() {
+    upX = 0;
+    upY = 0;
+    upZ = 1;
+    yaw = 0;
+    rotationX = 0;
+    rotationZ = 0;
+    initialized = false;
+  }
+
+  // Acceleration in g, rates in degrees/second, dt in seconds
+  void update(float ax, float ay, float az, float gx, float gy, float gz, float dt) {
+    update(ax, ay, az, sqrtf(ax * ax + ay * ay + az * az), gx, gy, gz, dt);
+  }
+
+  // Same, with |a| already computed by the caller
+  void update(float ax, float ay, float az, float accelNorm, float gx, float gy, float gz, float dt) {
+    rotationX += gx * dt;
+    rotationZ += gz * dt;
+
+    if (!initialized) {
+      if (accelNorm < 0.5f) return;
+      upX = ax / accelNorm;
+      upY = ay / accelNorm;
+      upZ = az / accelNorm;
+      initialized = true;
+      return;
+    }
+
+    yaw += (gx * upX + gy * upY + gz * upZ) * dt;
+
+    // A direction fixed in the world turns against the sensor: up += up x w
+    float wx = gx * RADIANS_PER_DEGREE * dt;
+    float wy = gy * RADIANS_PER_DEGREE * dt;
+    float wz = gz * RADIANS_PER_DEGREE * dt;
+    float x = upX + (upY * wz - upZ * wy);
+    float y = upY + (upZ * wx - upX * wz);
+    float z = upZ + (upX * wy - upY * wx);
+
+    if (fabsf(accelNorm - 1.0f) < OrientationConfig::ACCEL_REJECT_G) {
+      float gain = dt / (OrientationConfig::ACCEL_TIME_CONSTANT_S + dt);
+      float scale = gain / accelNorm;
+      x += ax * scale - x * gain;
+      y += ay * scale - y * gain;
+      z += az * scale - z * gain;
+    }
+
+    float length = sqrtf(x * x + y * y + z * z);
+    if (length > 0) {
+      upX = x / length;
+      upY = y / length;
+      upZ = z / length;
+    }
+  }
+
+  // "Up" along the sensor X axis: -1.0 (down) to 1.0 (up), the liquid tilt
+  float getTilt() const { return upX; }
+
+  // Gravity direction as a unit vector in sensor coordinates
+  void getUp(float& x, float& y, float& z) const {
+    x = upX;
+    y = upY;
+    z = upZ;
+  }
+
+  // Degrees, from the gravity estimate
+  float getRoll() const { return atan2f(upY, upZ) * DEGREES_PER_RADIAN; }
+  float getPitch() const { return atan2f(-upX, sqrtf(upY * upY + upZ * upZ)) * DEGREES_PER_RADIAN; }
+  float getYaw() const { return yaw; }
+
+  float getRotationX() const { return rotationX; }
+  float getRotationZ() const { return rotationZ; }
+  bool isInitialized() const { return initialized; }
+};
+
+#endif // ORIENTATION_FILTER_H
@@ -7,6 +7,7 @@
  * - 7-LED liquid physics simulation with tilt sensing
  * - Tempo detection from taps (3 taps = prediction, 4+ = continuous adjustment)
  * - Rotation-based gesture controls (barrel rolls & spins)
+ * - Recorded custom gestures (DTW templates) bound to commands
  * - 8 color palettes + 10 custom palette slots
  * - 6 animation patterns
  * - WiFi hotspot web dashboard
@@ -24,13 +25,21 @@
 #include "hardware/LEDController.h"
 #include "hardware/BatteryMonitor.h"
 #include "motion/GestureDetector.h"
+#include "motion/GestureRecognizer.h"
 #include "effects/PaletteManager.h"
 #include "effects/AnimationEngine.h"
+#include "effects/RenderScheduler.h"
 #include "tempo/TempoDetector.h"
 #include "tempo/BeatSynchronizer.h"
 #include "control/DeviceMode.h"
 #include "control/CommandParser.h"
+#include "control/CommandQueue.h"
 #include "control/WiFiServer.h"
+#include "control/StatusPublisher.h"
+#include "control/StatusFrame.h"
+#include "control/DeviceSnapshot.h"
+#include "control/TaskStats.h"
+#include "control/StageTimings.h"
 #include "control/DashboardHTML.h"
 
 // ===== GLOBAL HARDWARE =====
@@ -41,23 +50,71 @@ MPUSensor mpu;
 LEDController leds(&strip);
 BatteryMonitor battery;
 GestureDetector gestures;
+GestureRecognizer customGestures;        // Owned by the sensor task
 PaletteManager palettes;
 AnimationEngine animations(&leds, &palettes);
+RenderScheduler renderer;
 TempoDetector tempo;
 BeatSynchronizer beatSync;
 ModeController mode;
 CommandParser cmdParser;
+CommandQueue<WiFiConfig::COMMAND_QUEUE_SLOTS> webCommands;       // Pushed by the async TCP task
+CommandQueue<SystemConfig::SERIAL_QUEUE_SLOTS> serialCommands;  // Pushed by the network task (processSerial)
+CommandQueue<TaskConfig::SENSOR_REQUEST_SLOTS> sensorRequests;  // Commands on state the sensor task owns
+CommandQueue<GestureConfig::COMMAND_QUEUE_SLOTS> gestureCommands;  // Bound to recognized gestures, for the render task
+CommandParser sensorParser;               // Sensor task side of those commands
+StatusPublisher statusPublisher;
+SeqlockSnapshot<DeviceStateSnapshot> deviceSnapshot;  // Written by the render task, read by status readers
 CtenophoreWiFiServer wifiServer(
   WiFiConfig::SSID,
   WiFiConfig::PASSWORD,
   dashboard_html
 );
 
+// ===== TASK COMMUNICATION =====
+// Gesture detected by the sensor task, applied by the render task
+struct GestureEvent {
+  enum Type : uint8_t { TAP, X_ROTATION, Z_ROTATION, MOTION_STARTED };
+  Type type;
+  bool clockwise;
+  unsigned long time;            // millis() of the sample that completed it
+};
+
+// Latest motion reading (sensor task -> render task, newest wins)
+struct MotionState {
+  float tilt = 0;
+  float accelY = 0;
+  float accelZ = 1.0f;
+  bool moving = false;
+};
+
+QueueHandle_t gestureQueue;
+QueueHandle_t motionMailbox;
+MotionState motion;                         // Render task's copy
+unsigned long gestureSampleTime = 0;        // Sensor task: sample being processed
+unsigned long gesturesDropped = 0;
+
+TaskStats sensorStats("sensor", TaskConfig::SENSOR_PRIORITY);
+TaskStats renderStats("render", TaskConfig::RENDER_PRIORITY);
+TaskStats networkStats("network", TaskConfig::NETWORK_PRIORITY);
+StageTimings stageTimings;
+bool printStatsPeriodically = false;        // `stats=on`
+
 // ===== FUNCTION DECLARATIONS =====
 void setupCommands();
+void setupSensorCommands();
 void setupGestures();
-void handleTap();
+void forwardToSensorTask(const char* name, const CommandText& value);
+void renderFrame();
+void captureStatus(DashboardStatus& status);
+void publishSnapshot(unsigned long currentTime);
+void readSnapshot(DeviceStateSnapshot& snapshot);
+void publishStatus(unsigned long currentTime);
+void handleTap(unsigned long tapTime);
 void stopTempo();
+void startTasks();
+void queueGesture(GestureEvent::Type type, bool clockwise);
+void applyGestureEvents();
 
 // ===== SETUP =====
 void setup() {
@@ -90,6 +147,11 @@ void setup() {
   } else {
     Serial.println("⚠️ MPU-6050 not found - continuing without motion");
   }
+  int savedGestures = customGestures.load();
+  if (savedGestures > 0) {
+    Serial.print("✋ Custom gestures loaded: ");
+    Serial.println(savedGestures);
+  }
 
   // Initialize battery monitor
   // (battery monitor auto-initializes with global pin, no begin() needed)
@@ -107,6 +169,7 @@ void setup() {
 
   // Register command handlers
   setupCommands();
+  setupSensorCommands();
 
   // Setup gesture callbacks
   setupGestures();
@@ -126,56 +189,206 @@ void setup() {
 
   // Start in liquid mode
   mode.transitionTo(DeviceMode::LIQUID_IDLE);
+  publishSnapshot(millis());
 
   Serial.println("");
   Serial.println("🎨 Features:");
   Serial.println("  💧 Liquid tilt physics");
   Serial.println("  👟 Tap-to-tempo (stride tracking ready!)");
   Serial.println("  🔄 Rotation gestures (flip/spin)");
+  Serial.println("  ✋ Custom gestures (record=name, bind=name command)");
   Serial.println("  🌈 8 palettes + 10 custom slots");
   Serial.println("  ✨ 6 animation patterns");
   Serial.println("  📱 WiFi web dashboard");
   Serial.println("  🔋 Battery monitoring");
   Serial.println("");
   Serial.println("🪄 Ready! Tilt for liquid, tap for tempo!");
+
+  // Sensing, rendering and networking each get their own task from here on
+  startTasks();
 }
 
-// ===== MAIN LOOP =====
-void loop() {
-  unsigned long currentTime = millis();
-  static unsigned long lastMPURead = 0;
+// ===== TASKS =====
+// Sensor task: drains the MPU FIFO and runs gesture detection per sample;
+// gestures go to the render task as events, motion as the latest MotionState.
+// Commands on what this task owns (tap threshold, sensor statistics, custom
+// gestures) are applied here, between drains
+void sensorTask(void*) {
+  TickType_t lastWake = xTaskGetTickCount();
+  for (;;) {
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(TaskConfig::SENSOR_POLL_MS));
+    sensorStats.beginWork(micros());
+    sensorRequests.apply(sensorParser, 1);
+
+    int drained = 0;
+    if (mpu.isReadDue(millis())) {
+      ScopedStageTimer timer(stageTimings, Stage::SENSOR_DRAIN);
+      drained = mpu.read();
+    }
+    if (drained > 0) {
+      MotionState latest;
+      latest.tilt = mpu.getTiltAngle();
+      latest.accelY = mpu.getAccelY();
+      latest.accelZ = mpu.getAccelZ();
+      latest.moving = gestures.getIsMoving();
+      xQueueOverwrite(motionMailbox, &latest);
+    }
+
+    sensorStats.endWork(micros());
+    sensorStats.setStackFree(uxTaskGetStackHighWaterMark(NULL));
+  }
+}
+
+// Render task: owns the animation state. Everything that changes it
+// (gestures, commands, beats, mode timeouts) is applied at the start of a
+// frame, then the frame is drawn, latched and published.
+void renderTask(void*) {
+  for (;;) {
+    unsigned long untilFrameUs = renderer.getTimeUntilNextFrame(micros());
+    if (untilFrameUs > 0) {
+      TickType_t ticks = pdMS_TO_TICKS(untilFrameUs / 1000);
+      vTaskDelay(ticks > 0 ? ticks : 1);
+      continue;
+    }
+    if (!renderer.frameDue(micros())) continue;
+
+    renderStats.beginWork(micros());
+    renderer.beginFrame(micros());
+    unsigned long currentTime = millis();
+    {
+      ScopedStageTimer frameTimer(stageTimings, Stage::FRAME);
+      xQueuePeek(motionMailbox, &motion, 0);
+
+      // Gestures and queued commands land here, before anything is drawn; a
+      // dashboard batch is applied whole
+      {
+        ScopedStageTimer timer(stageTimings, Stage::COMMANDS);
+        applyGestureEvents();
+        int applied = gestureCommands.apply(cmdParser, SystemConfig::COMMANDS_PER_FRAME);
+        applied += serialCommands.apply(cmdParser, SystemConfig::COMMANDS_PER_FRAME, applied);
+        webCommands.apply(cmdParser, SystemConfig::COMMANDS_PER_FRAME, applied);
+      }
+
+      battery.update();
+      beatSync.update(currentTime);
+      mode.update(currentTime);
+      {
+        ScopedStageTimer timer(stageTimings, Stage::RENDER);
+        renderFrame();
+      }
 
-  // Read sensors (100Hz)
-  if (currentTime - lastMPURead >= 10) {
-    mpu.read();
-    lastMPURead = currentTime;
+      // Latch once per frame (skipped when the frame is unchanged)
+      {
+        ScopedStageTimer timer(stageTimings, Stage::SHOW);
+        leds.show();
+      }
+      renderer.endFrame(micros());
+
+      // Status readers see the state as of this frame
+      publishSnapshot(currentTime);
+    }
+    renderStats.endWork(micros());
+    renderStats.setStackFree(uxTaskGetStackHighWaterMark(NULL));
   }
+}
 
-  // Update gesture detection
-  gestures.update(mpu, currentTime);
+// Network task: serial input (queued for the render task) and dashboard push
+void networkTask(void*) {
+  for (;;) {
+    networkStats.beginWork(micros());
+    unsigned long currentTime = millis();
+    cmdParser.processSerial();
+    {
+      ScopedStageTimer timer(stageTimings, Stage::STATUS_PUSH);
+      publishStatus(currentTime);
+    }
+
+    static unsigned long lastStatsPrint = 0;
+    if (printStatsPeriodically && currentTime - lastStatsPrint >= SystemConfig::DEBUG_PRINT_INTERVAL_MS) {
+      lastStatsPrint = currentTime;
+      stageTimings.print();
+    }
+    networkStats.endWork(micros());
+    networkStats.setStackFree(uxTaskGetStackHighWaterMark(NULL));
 
-  // Update battery monitor
-  battery.update();
+    vTaskDelay(pdMS_TO_TICKS(TaskConfig::NETWORK_INTERVAL_MS));
+  }
+}
 
-  // Process serial commands
-  cmdParser.processSerial();
+void startTasks() {
+  gestureQueue = xQueueCreate(TaskConfig::GESTURE_QUEUE_LENGTH, sizeof(GestureEvent));
+  motionMailbox = xQueueCreate(1, sizeof(MotionState));
+  xQueueOverwrite(motionMailbox, &motion);
+
+  xTaskCreatePinnedToCore(sensorTask, "sensor", TaskConfig::SENSOR_STACK_BYTES, NULL,
+                          TaskConfig::SENSOR_PRIORITY, NULL, TaskConfig::CORE);
+  xTaskCreatePinnedToCore(renderTask, "render", TaskConfig::RENDER_STACK_BYTES, NULL,
+                          TaskConfig::RENDER_PRIORITY, NULL, TaskConfig::CORE);
+  xTaskCreatePinnedToCore(networkTask, "network", TaskConfig::NETWORK_STACK_BYTES, NULL,
+                          TaskConfig::NETWORK_PRIORITY, NULL, TaskConfig::CORE);
+}
 
-  // Update beat synchronization
-  beatSync.update(currentTime);
+// Sensor task side of the gesture callbacks
+void queueGesture(GestureEvent::Type type, bool clockwise) {
+  GestureEvent event;
+  event.type = type;
+  event.clockwise = clockwise;
+  event.time = gestureSampleTime;
+  if (xQueueSend(gestureQueue, &event, 0) != pdTRUE) {
+    gesturesDropped++;
+  }
+}
 
-  // Update mode timeout
-  mode.update(currentTime);
+// Render task side: act on every gesture detected since the last frame
+void applyGestureEvents() {
+  GestureEvent event;
+  while (xQueueReceive(gestureQueue, &event, 0) == pdTRUE) {
+    switch (event.type) {
+      case GestureEvent::TAP:
+        // EVERY tap triggers visual feedback (wearable-ready!)
+        handleTap(event.time);
+        break;
+
+      case GestureEvent::X_ROTATION:
+        // Barrel roll - cycle animations
+        Serial.println("🔄 Barrel roll detected!");
+        animations.cyclePattern(event.clockwise);
+        mode.transitionTo(DeviceMode::ROTATION_EFFECT);
+        mode.recordActivity();
+        break;
 
+      case GestureEvent::Z_ROTATION:
+        // Spin - cycle palettes
+        Serial.println("🌀 Spin detected!");
+        palettes.cycleNext(event.clockwise);
+        mode.transitionTo(DeviceMode::ROTATION_EFFECT);
+        mode.recordActivity();
+        break;
+
+      case GestureEvent::MOTION_STARTED:
+        mode.recordActivity();
+        break;
+    }
+  }
+}
+
+// Arduino's loop task is not used: the work runs in the tasks above
+void loop() {
+  vTaskDelete(NULL);
+}
+
+// ===== FRAME RENDER =====
+void renderFrame() {
   // Mode-specific updates
   switch (mode.getMode()) {
     case DeviceMode::LIQUID_IDLE:
     case DeviceMode::LIQUID_TILTING:
       // Liquid physics based on tilt
-      animations.updateLiquidPhysics(mpu.getTiltAngle(), gestures.getIsMoving());
-      animations.render(mpu.getTiltAngle());
+      animations.updateLiquidPhysics(motion.tilt, motion.moving);
+      animations.render(motion.tilt);
 
       // Check for mode transition
-      if (gestures.getIsMoving()) {
+      if (motion.moving) {
         mode.transitionTo(DeviceMode::LIQUID_TILTING);
         mode.recordActivity();
       } else if (mode.getMode() == DeviceMode::LIQUID_TILTING) {
@@ -187,7 +400,7 @@ void loop() {
     case DeviceMode::TEMPO_PLAYING:
       // Tempo mode - update animations
       animations.update();
-      animations.render(mpu.getTiltAngle());
+      animations.render(motion.tilt);
 
       // Auto-return to liquid after timeout
       if (mode.getTimeInMode() > TempoConfig::TEMPO_MODE_TIMEOUT_MS) {
@@ -208,7 +421,7 @@ void loop() {
 
     case DeviceMode::ROTATION_EFFECT:
       // Rotation sparkle effect
-      animations.render(mpu.getTiltAngle());
+      animations.render(motion.tilt);
 
       // Return to previous mode after effect
       if (mode.getTimeInMode() > 1000) {
@@ -216,33 +429,25 @@ void loop() {
       }
       break;
   }
-
-  // Apply final LED output
-  strip.show();
 }
 
 // ===== COMMAND SETUP =====
 void setupCommands() {
   static Command commands[] = {
-    {"tap", [](String) {
-      handleTap();
+    {"tap", [](const CommandText&) {
+      handleTap(millis());
     }},
-    {"reset", [](String) {
+    {"reset", [](const CommandText&) {
       stopTempo();
       Serial.println("🔄 Reset to liquid mode");
     }},
-    {"battery", [](String) {
+    {"battery", [](const CommandText&) {
       mode.transitionTo(DeviceMode::BATTERY_DISPLAY);
     }},
-    {"threshold", [](String value) {
-      float threshold;
-      if (CommandParser::parseFloat(value, threshold, 0.01f, 1.0f)) {
-        gestures.setTapThreshold(threshold);
-        Serial.print("🎛️ Tap threshold: ");
-        Serial.println(threshold);
-      }
+    {"threshold", [](const CommandText& value) {
+      forwardToSensorTask("threshold", value);
     }},
-    {"brightness", [](String value) {
+    {"brightness", [](const CommandText& value) {
       float brightness;
       if (CommandParser::parseFloat(value, brightness, 0.1f, 1.0f)) {
         leds.setBrightness(brightness);
@@ -250,7 +455,7 @@ void setupCommands() {
         Serial.println(brightness);
       }
     }},
-    {"palette", [](String value) {
+    {"palette", [](const CommandText& value) {
       int index;
       if (CommandParser::parseInt(value, index, 0, 17)) {
         palettes.setCurrentPalette(index);
@@ -258,7 +463,7 @@ void setupCommands() {
         Serial.println(index);
       }
     }},
-    {"pattern", [](String value) {
+    {"pattern", [](const CommandText& value) {
       // Map pattern name to index
       AnimationPattern pattern = AnimationPattern::PATTERN_RAINBOW_CYCLE;
       if (value == "breathing") pattern = AnimationPattern::PATTERN_BREATHING;
@@ -269,9 +474,10 @@ void setupCommands() {
 
       animations.setPattern(pattern);
       Serial.print("✨ Pattern: ");
-      Serial.println(value);
+      value.print();
+      Serial.println();
     }},
-    {"bpm", [](String value) {
+    {"bpm", [](const CommandText& value) {
       int bpm;
       if (CommandParser::parseInt(value, bpm, TempoConfig::MIN_BPM, TempoConfig::MAX_BPM)) {
         unsigned long interval = 60000 / bpm;
@@ -281,7 +487,55 @@ void setupCommands() {
         Serial.println(bpm);
       }
     }},
-    {"help", [](String) {
+    {"leds", [](const CommandText&) {
+      leds.printStats();
+      renderer.printStats();
+    }},
+    {"sensor", [](const CommandText& value) {
+      forwardToSensorTask("sensor", value);
+    }},
+    {"tasks", [](const CommandText&) {
+      sensorStats.print();
+      renderStats.print();
+      networkStats.print();
+      Serial.print("🧵 Gestures dropped: ");
+      Serial.println(gesturesDropped);
+    }},
+    {"stats", [](const CommandText& value) {
+      if (value == "reset") {
+        stageTimings.reset();
+        Serial.println("⏱️ Stage timings reset");
+      } else if (!value.isEmpty()) {
+        printStatsPeriodically = CommandParser::parseBool(value);
+        Serial.print("⏱️ Periodic stage timings: ");
+        Serial.println(printStatsPeriodically ? "on" : "off");
+      } else {
+        stageTimings.print();
+      }
+    }},
+    {"gestures", [](const CommandText& value) {
+      forwardToSensorTask("gestures", value);
+    }},
+    {"record", [](const CommandText& value) {
+      forwardToSensorTask("record", value);
+    }},
+    {"bind", [](const CommandText& value) {
+      int space = value.indexOf(' ');
+      if (space >= 0 && !cmdParser.isKnown(value.substring(space + 1, value.length))) {
+        Serial.println("❌ Unknown command - not bound");
+        return;
+      }
+      forwardToSensorTask("bind", value);
+    }},
+    {"forget", [](const CommandText& value) {
+      forwardToSensorTask("forget", value);
+    }},
+    {"dither", [](const CommandText& value) {
+      leds.setOutputStage(value != "off");
+      Serial.print("🌗 Gamma + dither: ");
+      Serial.println(leds.isOutputStageEnabled() ? "on" : "off");
+    }},
+    {"help", [](const CommandText&) {
       Serial.println("📋 Commands:");
       Serial.println("  tap              - Simulate tap");
       Serial.println("  reset            - Return to liquid mode");
@@ -291,77 +545,214 @@ void setupCommands() {
       Serial.println("  palette=0        - Change color palette (0-17)");
       Serial.println("  pattern=rainbow  - Change animation pattern");
       Serial.println("  bpm=120          - Set manual tempo");
+      Serial.println("  leds             - Show frame/latch statistics");
+      Serial.println("  sensor           - Show sensor/FIFO/I2C statistics");
+      Serial.println("  tasks            - Show task load and stack headroom");
+      Serial.println("  stats            - Stage timings (stats=reset, stats=on/off)");
+      Serial.println("  gestures         - List custom gestures and match statistics");
+      Serial.println("  record=flick     - Record the next motion as a custom gesture");
+      Serial.println("  bind=flick palette=3 - Run a command when the gesture is recognized");
+      Serial.println("  forget=flick     - Delete a custom gesture");
+      Serial.println("  dither=off       - Toggle gamma + dithered output");
       Serial.println("  help             - Show this menu");
     }}
   };
 
   cmdParser.registerCommands(commands, sizeof(commands) / sizeof(Command));
 
+  // Serial lines wait for the next frame like web commands
+  cmdParser.setSerialLineHandler([](const CommandText& line) {
+    if (!serialCommands.push(line)) {
+      Serial.println("❌ Command queue full");
+    }
+  });
+
   // Setup WiFi callbacks
-  wifiServer.setCommandCallback([](String cmd) {
-    cmdParser.parse(cmd);
+  // Web batches are checked here (async TCP task) and applied by the render task
+  wifiServer.setCommandCallback([](const CommandText* commands, int count) -> CommandResult {
+    for (int i = 0; i < count; i++) {
+      if (commands[i].length > SystemConfig::COMMAND_MAX_LENGTH || !cmdParser.isKnown(commands[i])) {
+        return CommandResult::INVALID;
+      }
+    }
+    return webCommands.pushBatch(commands, count) ? CommandResult::QUEUED : CommandResult::BUSY;
   });
 
+  // One-off /status requests get a full snapshot; they run on the async TCP
+  // task, so they only ever see a published snapshot
   wifiServer.setStatusCallback([]() -> String {
-    StaticJsonDocument<512> doc;
-
-    doc["mode"] = mode.getMode() == DeviceMode::LIQUID_IDLE || mode.getMode() == DeviceMode::LIQUID_TILTING ? "liquid" : "tempo";
-    doc["bpm"] = tempo.getBPM();
-    doc["batteryPercent"] = battery.getPercentage();
-    doc["currentPalette"] = palettes.getCurrentIndex();
-    doc["currentPattern"] = (int)animations.getPattern();
-    doc["tiltAngle"] = mpu.getTiltAngle();
-    doc["accelY"] = mpu.getAccelY();
-    doc["accelZ"] = mpu.getAccelZ();
-    doc["beat"] = beatSync.getIsActive();
-
-    // LED brightness array
-    JsonArray leds_array = doc.createNestedArray("leds");
-    for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
-      leds_array.add(animations.getLEDBrightness(i));
-    }
+    DeviceStateSnapshot snapshot;
+    readSnapshot(snapshot);
 
-    String output;
-    serializeJson(doc, output);
-    return output;
+    char json[StatusPublisher::MAX_MESSAGE_SIZE];
+    StatusPublisher::formatFields(snapshot.status, nullptr, json, sizeof(json));
+    return String(json);
+  });
+
+  wifiServer.setMetricsCallback([](char* out, size_t size) -> size_t {
+    return stageTimings.formatMetrics(out, size);
+  });
+
+  wifiServer.setStatusFrameCallback([](uint8_t* buffer, size_t size) -> size_t {
+    if (size < StatusFrame::SIZE) return 0;
+    DeviceStateSnapshot snapshot;
+    readSnapshot(snapshot);
+
+    StatusFrame::Frame frame;
+    StatusFrame::encode(snapshot.status, frame);
+    memcpy(buffer, &frame, StatusFrame::SIZE);
+    return StatusFrame::SIZE;
   });
 }
 
+// Sensor task side of the commands that change its state
+void setupSensorCommands() {
+  static Command commands[] = {
+    {"threshold", [](const CommandText& value) {
+      float threshold;
+      if (CommandParser::parseFloat(value, threshold, 0.01f, 1.0f)) {
+        gestures.setTapThreshold(threshold);
+        Serial.print("🎛️ Tap threshold: ");
+        Serial.println(threshold);
+      }
+    }},
+    {"sensor", [](const CommandText&) {
+      mpu.printData();
+      mpu.printBusStats();
+      mpu.getCalibration().print(mpu.getTemperature());
+      Serial.print("👆 Tap baseline: ");
+      Serial.print(gestures.getTapBaseline(), 3);
+      Serial.print(" g | noise: ");
+      Serial.print(gestures.getAccelNoise(), 3);
+      Serial.println(" g");
+    }},
+    {"gestures", [](const CommandText&) {
+      customGestures.print();
+    }},
+    {"record", [](const CommandText& value) {
+      customGestures.startRecording(value);
+    }},
+    {"bind", [](const CommandText& value) {
+      customGestures.bind(value);
+    }},
+    {"forget", [](const CommandText& value) {
+      customGestures.forget(value);
+    }}
+  };
+
+  sensorParser.registerCommands(commands, sizeof(commands) / sizeof(Command));
+}
+
+// Gesture detection belongs to the sensor task: hand it the command as
+// "name=value", applied between two drains
+void forwardToSensorTask(const char* name, const CommandText& value) {
+  char line[SystemConfig::COMMAND_MAX_LENGTH + 1];
+  int length = snprintf(line, sizeof(line), "%s=%.*s", name, (int)value.length, value.data);
+  if (length < 0 || length >= (int)sizeof(line) || !sensorRequests.push(CommandText(line, length))) {
+    Serial.println("❌ Sensor command not queued");
+  }
+}
+
+// ===== DASHBOARD STATUS =====
+void captureStatus(DashboardStatus& status) {
+  status.liquid = mode.getMode() == DeviceMode::LIQUID_IDLE || mode.getMode() == DeviceMode::LIQUID_TILTING;
+  status.bpm = tempo.getBPM();
+  status.batteryPercent = battery.getPercentage();
+  status.palette = palettes.getCurrentIndex();
+  status.pattern = (int)animations.getPattern();
+  status.tilt = DashboardStatus::hundredths(motion.tilt);
+  status.accelY = DashboardStatus::hundredths(motion.accelY);
+  status.accelZ = DashboardStatus::hundredths(motion.accelZ);
+  status.beat = beatSync.getIsActive();
+
+  for (int i = 0; i < HardwareConfig::NUM_LEDS; i++) {
+    status.leds[i] = (uint8_t)constrain(DashboardStatus::hundredths(animations.getLEDBrightness(i)), 0, 100);
+    status.colors[i] = leds.getColor(i);
+  }
+}
+
+// Render task, once per frame
+void publishSnapshot(unsigned long currentTime) {
+  static uint32_t frame = 0;
+  DeviceStateSnapshot snapshot;
+  snapshot.frame = ++frame;
+  snapshot.capturedAt = currentTime;
+  captureStatus(snapshot.status);
+  deviceSnapshot.publish(snapshot);
+}
+
+// Any task; keeps the previous contents of `snapshot` in the (unlikely) case
+// that every attempt overlapped a publish
+void readSnapshot(DeviceStateSnapshot& snapshot) {
+  if (!deviceSnapshot.read(snapshot)) {
+    Serial.println("⚠️ Status snapshot busy");
+  }
+}
+
+// Broadcast what changed since the last push (nothing when no dashboard
+// listens); network task
+void publishStatus(unsigned long currentTime) {
+  static unsigned long lastPush = 0;
+  if (currentTime - lastPush < WiFiConfig::STATUS_UPDATE_INTERVAL_MS) return;
+  lastPush = currentTime;
+
+  if (!wifiServer.hasStatusListeners()) return;
+  if (wifiServer.takeClientJoined()) {
+    statusPublisher.requestFull();
+  }
+
+  DeviceStateSnapshot snapshot;
+  readSnapshot(snapshot);
+
+  char json[StatusPublisher::MAX_MESSAGE_SIZE];
+  if (statusPublisher.format(snapshot.status, currentTime, json, sizeof(json)) > 0) {
+    wifiServer.pushStatus(json);
+  }
+}
+
 // ===== GESTURE SETUP =====
 void setupGestures() {
-  // Tap callback - EVERY tap triggers visual feedback (wearable-ready!)
+  // Every FIFO sample goes through gesture detection (oldest first), on the
+  // sensor task; callbacks only queue events for the render task
+  mpu.setOnSample([](MPUSensor& sample, unsigned long sampleTime) {
+    ScopedStageTimer timer(stageTimings, Stage::GESTURES);
+    gestureSampleTime = sampleTime;
+    gestures.update(sample, sampleTime);
+    customGestures.update(sample);
+  });
+
+  // Recognized custom gestures run their bound command on the render task
+  customGestures.setOnGesture([](int slot) {
+    const GestureRecognizer::Template& gesture = customGestures.getTemplate(slot);
+    Serial.print("✋ Gesture: ");
+    Serial.println(gesture.name);
+    if (gesture.command[0] && !gestureCommands.push(CommandText(gesture.command))) {
+      gesturesDropped++;
+    }
+  });
+
   gestures.setOnTap([]() {
-    handleTap();
+    queueGesture(GestureEvent::TAP, false);
   });
 
-  // Barrel roll callback (X-axis) - cycle animations
+  // Barrel roll (X-axis) cycles animations, spin (Z-axis) cycles palettes
   gestures.setOnXRotation([](bool clockwise) {
-    Serial.println("🔄 Barrel roll detected!");
-    animations.cyclePattern(clockwise);
-    mode.transitionTo(DeviceMode::ROTATION_EFFECT);
-    mode.recordActivity();
+    queueGesture(GestureEvent::X_ROTATION, clockwise);
   });
 
-  // Spin callback (Z-axis) - cycle palettes
   gestures.setOnZRotation([](bool clockwise) {
-    Serial.println("🌀 Spin detected!");
-    palettes.cycleNext(clockwise);
-    mode.transitionTo(DeviceMode::ROTATION_EFFECT);
-    mode.recordActivity();
+    queueGesture(GestureEvent::Z_ROTATION, clockwise);
   });
 
-  // Motion callback
   gestures.setOnMotionChange([](bool moving) {
     if (moving) {
-      mode.recordActivity();
+      queueGesture(GestureEvent::MOTION_STARTED, false);
     }
   });
 }
 
 // ===== TAP HANDLER =====
-void handleTap() {
-  unsigned long currentTime = millis();
-
+void handleTap(unsigned long currentTime) {
   // FIRST TAP: Switch from liquid to tempo mode
   if (!mode.isInTempoMode()) {
     Serial.println("🌊➡️🎵 TAP! Switching to tempo mode!");
@@ -4,13 +4,17 @@
 #include <Arduino.h>
 #include <functional>
 #include "../hardware/MPUSensor.h"
+#include "RunningWindow.h"
 #include "../config/Constants.h"
 
 // Rotation detector for barrel rolls and spins
 // Uses POSITION-BASED detection: tracks if device completes a full 360° rotation
+// Fed the integrated angle about its axis (MPUSensor's orientation filter) and
+// the rate; angle changes only count while the rate says it is spinning.
 class RotationDetector {
 private:
   float cumulativeRotation;      // Total rotation accumulated
+  float lastAngle;                // Integrated angle at the previous update
   float startingRotation;         // Rotation value when fast spin started
   unsigned long lastRotationTime;
   bool isRotating;                // Currently in a fast rotation
@@ -21,6 +25,7 @@ private:
 public:
   RotationDetector(const char* detectorName)
     : cumulativeRotation(0),
+      lastAngle(0),
       startingRotation(0),
       lastRotationTime(0),
       isRotating(false),
@@ -31,9 +36,11 @@ public:
     onTrigger = callback;
   }
 
-  // Update with gyro value
-  void update(float gyroValue, unsigned long currentTime) {
+  // Update with the integrated angle (degrees) and rate (degrees/second)
+  void update(float angle, float gyroValue, unsigned long currentTime) {
     bool isSpinning = abs(gyroValue) > RotationConfig::GYRO_THRESHOLD;
+    float angleStep = angle - lastAngle;
+    lastAngle = angle;
 
     // START of rotation - note starting position
     if (isSpinning && !isRotating) {
@@ -47,7 +54,7 @@ public:
 
     // Accumulate rotation while spinning
     if (isSpinning) {
-      cumulativeRotation += gyroValue * RotationConfig::GYRO_SCALE_FACTOR;
+      cumulativeRotation += angleStep;
       lastRotationTime = currentTime;
     }
 
@@ -109,7 +116,7 @@ public:
 class GestureDetector {
 private:
   // Tap detection state
-  float tapHistory[MotionConfig::TAP_HISTORY_SIZE];
+  RunningWindow<MotionConfig::TAP_HISTORY_SIZE> tapHistory;  // Recent magnitudes (baseline)
   float tapThreshold;
   unsigned long lastTapTime;
   std::function<void()> onTap;
@@ -128,7 +135,8 @@ private:
 
 public:
   GestureDetector()
-    : tapThreshold(MotionConfig::TAP_THRESHOLD),
+    : tapHistory(1.0f),
+      tapThreshold(MotionConfig::TAP_THRESHOLD),
       lastTapTime(0),
       lastAccelMagnitude(1.0),
       lastMotionTime(0),
@@ -136,12 +144,7 @@ public:
       isMoving(false),
       isShaking(false),
       xRotationDetector("Barrel Roll"),
-      zRotationDetector("Spin") {
-    // Initialize tap history
-    for (int i = 0; i < MotionConfig::TAP_HISTORY_SIZE; i++) {
-      tapHistory[i] = 1.0;
-    }
-  }
+      zRotationDetector("Spin") {}
 
   // Set callbacks
   void setOnTap(std::function<void()> callback) {
@@ -167,33 +170,25 @@ public:
 
   // Update gesture detection with latest sensor data
   void update(MPUSensor& mpu, unsigned long currentTime) {
+    // The sensor's one magnitude per sample, shared by the tap and motion checks
+    float magnitude = mpu.getAccelMagnitude();
+
     // Update tap detection
-    checkTap(mpu, currentTime);
+    checkTap(magnitude, currentTime);
 
     // Update motion detection
-    checkMotion(mpu, currentTime);
+    checkMotion(magnitude, currentTime);
 
     // Update rotation detection
-    xRotationDetector.update(mpu.getGyroX(), currentTime);
-    zRotationDetector.update(mpu.getGyroZ(), currentTime);
+    xRotationDetector.update(mpu.getRotationX(), mpu.getGyroX(), currentTime);
+    zRotationDetector.update(mpu.getRotationZ(), mpu.getGyroZ(), currentTime);
   }
 
-  // Check for tap gesture
-  void checkTap(MPUSensor& mpu, unsigned long currentTime) {
-    float totalAccel = mpu.getAccelMagnitude();
-
-    // Shift tap history
-    for (int i = 0; i < MotionConfig::TAP_HISTORY_SIZE - 1; i++) {
-      tapHistory[i] = tapHistory[i + 1];
-    }
-    tapHistory[MotionConfig::TAP_HISTORY_SIZE - 1] = totalAccel;
-
-    // Calculate average baseline
-    float avgAccel = 0;
-    for (int i = 0; i < MotionConfig::TAP_HISTORY_SIZE; i++) {
-      avgAccel += tapHistory[i];
-    }
-    avgAccel /= MotionConfig::TAP_HISTORY_SIZE;
+  // Check for tap gesture (totalAccel: magnitude of this sample, in g)
+  void checkTap(float totalAccel, unsigned long currentTime) {
+    // Average baseline over the window, this sample included
+    tapHistory.push(totalAccel);
+    float avgAccel = tapHistory.getMean();
 
     // Detect spike above baseline
     float spikeAboveBaseline = totalAccel - avgAccel;
@@ -215,8 +210,7 @@ public:
   }
 
   // Check for general movement
-  void checkMotion(MPUSensor& mpu, unsigned long currentTime) {
-    float currentMagnitude = mpu.getAccelMagnitude();
+  void checkMotion(float currentMagnitude, unsigned long currentTime) {
     float motionDelta = abs(currentMagnitude - lastAccelMagnitude);
 
     bool wasMoving = isMoving;
@@ -251,6 +245,8 @@ public:
   bool getIsShaking() const { return isShaking; }
   unsigned long getLastTapTime() const { return lastTapTime; }
   unsigned long getLastMotionTime() const { return lastMotionTime; }
+  float getTapBaseline() const { return tapHistory.getMean(); }
+  float getAccelNoise() const { return sqrtf(tapHistory.getVariance()); }
 };
 
 #endif // GESTURE_DETECTOR_H
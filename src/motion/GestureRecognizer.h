@@ -0,0 +1,538 @@
+#ifndef GESTURE_RECOGNIZER_H
+#define GESTURE_RECOGNIZER_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <functional>
+#include <string.h>
+#include "../hardware/MPUSensor.h"
+#include "../control/CommandParser.h"
+#include "../config/Constants.h"
+
+// Custom gestures: recorded 6-axis templates matched by dynamic time warping
+// Samples are averaged into frames at GestureConfig::FRAME_RATE_HZ of six
+// int16 features: linear acceleration (gravity removed with the orientation
+// filter's "up") and rotation rate, square-root companded so that doing a
+// gesture faster or harder costs less than not doing it. A template is one
+// recorded motion. Each new frame, every template is aligned with the newest
+// live frames:
+// - the alignment ends on the newest frame and may start anywhere, with the
+//   live motion running 2/3x to 1.5x the template's length;
+// - its cost is the summed L1 distance along the warping path, in integers;
+// - a template matches when the cost is within MATCH_RATIO_Q8/256 of its
+//   energy (its cost against a still device), so strong and gentle gestures
+//   share one threshold.
+// The path is filled in from the newest frame backwards and crosses every
+// template row, so once a whole row costs more than the threshold or the best
+// match so far, that template is abandoned; at rest most templates stop after
+// a row or two. A match fires when the best candidate has held for
+// SETTLE_FRAMES, then the live window starts over.
+// Templates (with the command bound to them) are kept in flash.
+class GestureRecognizer {
+public:
+  static constexpr int AXES = 6;
+  static constexpr int SAMPLES_PER_FRAME = MPUConfig::SAMPLE_RATE_HZ / GestureConfig::FRAME_RATE_HZ;
+  static constexpr int LIVE_FRAMES = (3 * (GestureConfig::MAX_TEMPLATE_FRAMES - 1) + 1) / 2 + 1;
+  static constexpr int32_t NO_MATCH = INT32_MAX;
+
+  static_assert(MPUConfig::SAMPLE_RATE_HZ % GestureConfig::FRAME_RATE_HZ == 0,
+                "Gesture frames must span a whole number of samples");
+
+  struct Frame {
+    int16_t values[AXES];      // Linear accel XYZ, rate XYZ (feature units)
+  };
+
+  struct Template {
+    char name[GestureConfig::NAME_LENGTH];
+    char command[SystemConfig::COMMAND_MAX_LENGTH + 1];  // Bound command, "" if none
+    uint8_t length;            // Frames; 0 = free slot
+    int32_t energy;            // Summed frame norms (cost against stillness)
+    Frame frames[GestureConfig::MAX_TEMPLATE_FRAMES];
+  };
+
+private:
+  static constexpr int32_t UNREACHED = INT32_MAX / 2;
+  static constexpr uint32_t STORED_VERSION = 1;
+
+  struct Stored {
+    uint32_t version;
+    Template gesture;
+  };
+
+  enum class RecordState : uint8_t { IDLE, WAITING, RECORDING };
+
+  Template templates[GestureConfig::MAX_TEMPLATES];
+  unsigned long matchCounts[GestureConfig::MAX_TEMPLATES];
+  std::function<void(int)> onGesture;
+
+  // Frame being averaged
+  int32_t frameSum[AXES];
+  int frameSamples;
+
+  // Newest LIVE_FRAMES frames, oldest first; liveCount since the last clear
+  Frame live[LIVE_FRAMES];
+  int liveCount;
+
+  // Best match waiting to settle
+  int candidate;
+  int32_t candidateCost;
+  int candidateAge;
+
+  // Recording
+  RecordState recordState;
+  Template recording;
+  int recordSlot;
+  int quietFrames;
+  int waitFrames;
+
+  // Alignment rows, indexed by frames back from the newest
+  int32_t previousRow[LIVE_FRAMES];
+  int32_t currentRow[LIVE_FRAMES];
+  bool earlyAbandon;
+
+  // Flash record scratch: ~470 B kept off the sensor task's stack
+  Stored stored;
+
+  // Statistics
+  unsigned long framesMatched;
+  unsigned long alignments;
+  unsigned long abandoned;
+  unsigned long cells;
+
+public:
+  GestureRecognizer()
+    : frameSamples(0),
+      liveCount(0),
+      candidate(-1),
+      candidateCost(0),
+      candidateAge(0),
+      recordState(RecordState::IDLE),
+      recordSlot(-1),
+      quietFrames(0),
+      waitFrames(0),
+      earlyAbandon(true),
+      framesMatched(0),
+      alignments(0),
+      abandoned(0),
+      cells(0) {
+    memset(templates, 0, sizeof(templates));
+    memset(matchCounts, 0, sizeof(matchCounts));
+    memset(frameSum, 0, sizeof(frameSum));
+  }
+
+  // Called with the slot of every recognized gesture
+  void setOnGesture(std::function<void(int)> callback) {
+    onGesture = callback;
+  }
+
+  // Templates saved by a previous run; returns how many were found.
+  // Records that could not have been saved by this version are skipped
+  int load() {
+    Preferences preferences;
+    preferences.begin(GestureConfig::PREFERENCES_NAMESPACE, true);
+    int found = 0;
+    for (int slot = 0; slot < GestureConfig::MAX_TEMPLATES; slot++) {
+      char key[4];
+      keyFor(slot, key);
+      if (preferences.getBytesLength(key) == sizeof(Stored) &&
+          preferences.getBytes(key, &stored, sizeof(Stored)) == sizeof(Stored) &&
+          stored.version == STORED_VERSION && isValid(stored.gesture)) {
+        templates[slot] = stored.gesture;
+        found++;
+      }
+    }
+    preferences.end();
+    return found;
+  }
+
+  // One sample from the sensor; true when it completed a frame
+  bool update(const MPUSensor& mpu) {
+    float upX, upY, upZ;
+    mpu.getOrientation().getUp(upX, upY, upZ);
+    return update(mpu.getAccelX(), mpu.getAccelY(), mpu.getAccelZ(),
+                  mpu.getGyroX(), mpu.getGyroY(), mpu.getGyroZ(), upX, upY, upZ);
+  }
+
+  // Acceleration in g, rates in dps, "up" as a unit vector
+  bool update(float ax, float ay, float az, float gx, float gy, float gz,
+              float upX, float upY, float upZ) {
+    frameSum[0] += toFeature(ax - upX, GestureConfig::ACCEL_SCALE);
+    frameSum[1] += toFeature(ay - upY, GestureConfig::ACCEL_SCALE);
+    frameSum[2] += toFeature(az - upZ, GestureConfig::ACCEL_SCALE);
+    frameSum[3] += toFeature(gx, GestureConfig::GYRO_SCALE);
+    frameSum[4] += toFeature(gy, GestureConfig::GYRO_SCALE);
+    frameSum[5] += toFeature(gz, GestureConfig::GYRO_SCALE);
+    if (++frameSamples < SAMPLES_PER_FRAME) return false;
+
+    Frame frame;
+    for (int axis = 0; axis < AXES; axis++) {
+      frame.values[axis] = compand(frameSum[axis] / SAMPLES_PER_FRAME);
+      frameSum[axis] = 0;
+    }
+    frameSamples = 0;
+    pushFrame(frame);
+    return true;
+  }
+
+  // One frame: recording, or matching against every template
+  void pushFrame(const Frame& frame) {
+    memmove(live, live + 1, sizeof(Frame) * (LIVE_FRAMES - 1));
+    live[LIVE_FRAMES - 1] = frame;
+    if (liveCount < LIVE_FRAMES) liveCount++;
+
+    if (recordState != RecordState::IDLE) {
+      record(frame);
+    } else {
+      match();
+    }
+  }
+
+  // Record the next motion as `name` (replacing a template of that name)
+  bool startRecording(const CommandText& name) {
+    if (name.isEmpty() || name.length >= (size_t)GestureConfig::NAME_LENGTH || name.indexOf(' ') >= 0) {
+      Serial.print("❌ Gesture names are 1-");
+      Serial.print(GestureConfig::NAME_LENGTH - 1);
+      Serial.println(" characters, no spaces");
+      return false;
+    }
+    int slot = find(name);
+    if (slot < 0) slot = find(CommandText());
+    if (slot < 0) {
+      Serial.println("❌ No free gesture slot - forget one first");
+      return false;
+    }
+
+    memset(&recording, 0, sizeof(recording));
+    memcpy(recording.name, name.data, name.length);
+    recordSlot = slot;
+    recordState = RecordState::WAITING;
+    waitFrames = 0;
+    quietFrames = 0;
+    Serial.print("✋ Recording '");
+    name.print();
+    Serial.println("' - perform the gesture");
+    return true;
+  }
+
+  // Bind "name command..." (empty command: unbind)
+  bool bind(const CommandText& value) {
+    CommandText text = value.trimmed();
+    int space = text.indexOf(' ');
+    CommandText name = space < 0 ? text : text.substring(0, space);
+    CommandText command = space < 0 ? CommandText() : text.substring(space + 1, text.length).trimmed();
+    int slot = find(name);
+    if (name.isEmpty() || slot < 0) {
+      Serial.print("❌ Unknown gesture: ");
+      name.print();
+      Serial.println();
+      return false;
+    }
+    if (command.length > (size_t)SystemConfig::COMMAND_MAX_LENGTH) {
+      Serial.println("❌ Command too long");
+      return false;
+    }
+
+    memset(templates[slot].command, 0, sizeof(templates[slot].command));
+    memcpy(templates[slot].command, command.data, command.length);
+    save(slot);
+    Serial.print("✋ ");
+    Serial.print(templates[slot].name);
+    Serial.print(command.isEmpty() ? " unbound" : " -> ");
+    command.print();
+    Serial.println();
+    return true;
+  }
+
+  bool forget(const CommandText& name) {
+    int slot = name.isEmpty() ? -1 : find(name);
+    if (slot < 0) {
+      Serial.print("❌ Unknown gesture: ");
+      name.print();
+      Serial.println();
+      return false;
+    }
+    Serial.print("✋ Forgot ");
+    Serial.println(templates[slot].name);
+    memset(&templates[slot], 0, sizeof(Template));
+    matchCounts[slot] = 0;
+    if (candidate == slot) candidate = -1;
+
+    Preferences preferences;
+    preferences.begin(GestureConfig::PREFERENCES_NAMESPACE, false);
+    char key[4];
+    keyFor(slot, key);
+    preferences.remove(key);
+    preferences.end();
+    return true;
+  }
+
+  // Slot of the template called `name` (empty name: first free slot), or -1
+  int find(const CommandText& name) const {
+    for (int slot = 0; slot < GestureConfig::MAX_TEMPLATES; slot++) {
+      if (name.isEmpty() ? templates[slot].length == 0
+                         : templates[slot].length > 0 && name.equals(templates[slot].name)) {
+        return slot;
+      }
+    }
+    return -1;
+  }
+
+  // Cost of aligning template `slot` with the newest live frames, or
+  // NO_MATCH if it exceeds `limit` (abandoned as soon as that is certain)
+  int32_t align(int slot, int32_t limit) {
+    const Template& gesture = templates[slot];
+    int m = gesture.length;
+    int n = min(liveCount, (3 * (m - 1) + 1) / 2 + 1);
+    if (m == 0 || n - 1 < 2 * (m - 1) / 3) return NO_MATCH;
+    const Frame* newest = live + LIVE_FRAMES - 1;
+    alignments++;
+
+    // Row r is template frame m-1-r; column k is live frame k back from the
+    // newest. Row r spans k = 2r/3 .. 3r/2 (the stretch limits)
+    int previousLow = 0;
+    int previousHigh = -1;
+    for (int r = 0; r < m; r++) {
+      const Frame& expected = gesture.frames[m - 1 - r];
+      int low = 2 * r / 3;
+      int high = min((3 * r + 1) / 2, n - 1);
+      int32_t rowMin = UNREACHED;
+
+      for (int k = low; k <= high; k++) {
+        int32_t best;
+        if (r == 0) {
+          best = k == 0 ? 0 : UNREACHED;
+        } else {
+          best = UNREACHED;
+          if (k >= previousLow && k <= previousHigh) best = previousRow[k];
+          if (k - 1 >= previousLow && k - 1 <= previousHigh) best = min(best, previousRow[k - 1]);
+        }
+        if (k > low) best = min(best, currentRow[k - 1]);
+        int32_t cost = best >= UNREACHED ? UNREACHED : best + distance(expected, newest[-k]);
+        currentRow[k] = cost;
+        rowMin = min(rowMin, cost);
+      }
+      cells += high - low + 1;
+
+      // Every path crosses this row: none can end under `limit` any more
+      if (earlyAbandon && rowMin > limit) {
+        abandoned++;
+        return NO_MATCH;
+      }
+      memcpy(previousRow + low, currentRow + low, sizeof(int32_t) * (high - low + 1));
+      previousLow = low;
+      previousHigh = high;
+    }
+
+    // Free start: the alignment may begin at any column of the last row
+    int32_t cost = UNREACHED;
+    for (int k = previousLow; k <= previousHigh; k++) cost = min(cost, previousRow[k]);
+    return cost <= limit ? cost : NO_MATCH;
+  }
+
+  static int32_t distance(const Frame& a, const Frame& b) {
+    int32_t sum = 0;
+    for (int axis = 0; axis < AXES; axis++) {
+      sum += abs((int32_t)a.values[axis] - b.values[axis]);
+    }
+    return sum;
+  }
+
+  static int32_t norm(const Frame& frame) {
+    int32_t sum = 0;
+    for (int axis = 0; axis < AXES; axis++) sum += abs((int32_t)frame.values[axis]);
+    return sum;
+  }
+
+  // Off: every alignment runs to the end (same decisions, for comparison)
+  void setEarlyAbandon(bool enabled) { earlyAbandon = enabled; }
+
+  bool isRecording() const { return recordState != RecordState::IDLE; }
+  const Template& getTemplate(int slot) const { return templates[slot]; }
+  const Frame& getNewestFrame() const { return live[LIVE_FRAMES - 1]; }
+  unsigned long getMatchCount(int slot) const { return matchCounts[slot]; }
+  unsigned long getFramesMatched() const { return framesMatched; }
+  unsigned long getAlignments() const { return alignments; }
+  unsigned long getAbandoned() const { return abandoned; }
+  unsigned long getCells() const { return cells; }
+
+  int getTemplateCount() const {
+    int count = 0;
+    for (int slot = 0; slot < GestureConfig::MAX_TEMPLATES; slot++) {
+      if (templates[slot].length > 0) count++;
+    }
+    return count;
+  }
+
+  void print() const {
+    Serial.print("✋ Gestures ");
+    Serial.print(getTemplateCount());
+    Serial.print("/");
+    Serial.print(GestureConfig::MAX_TEMPLATES);
+    Serial.print(" | ");
+    Serial.print(framesMatched);
+    Serial.print(" frames, ");
+    Serial.print(alignments);
+    Serial.print(" alignments (");
+    Serial.print(alignments > 0 ? abandoned * 100 / alignments : 0);
+    Serial.print("% abandoned, ");
+    Serial.print(alignments > 0 ? cells / alignments : 0);
+    Serial.println(" cells each)");
+    for (int slot = 0; slot < GestureConfig::MAX_TEMPLATES; slot++) {
+      const Template& gesture = templates[slot];
+      if (gesture.length == 0) continue;
+      Serial.print("  ");
+      Serial.print(gesture.name);
+      Serial.print(": ");
+      Serial.print(gesture.length * 1000 / GestureConfig::FRAME_RATE_HZ);
+      Serial.print(" ms, ");
+      Serial.print(matchCounts[slot]);
+      Serial.print(" matches");
+      if (gesture.command[0]) {
+        Serial.print(" -> ");
+        Serial.print(gesture.command);
+      }
+      Serial.println();
+    }
+  }
+
+private:
+  static int32_t toFeature(float value, float scale) {
+    return constrain(lroundf(value * scale), -32767L, 32767L);
+  }
+
+  // sign(x) * sqrt(256 |x|): a gesture done 1.5x harder moves its features
+  // about 1.2x, while anything vs stillness still costs its full size
+  static int16_t compand(int32_t value) {
+    uint32_t x = (uint32_t)abs(value) << 8;
+    uint32_t root = 0;
+    for (uint32_t bit = 1UL << 30; bit; bit >>= 2) {
+      if (x >= root + bit) {
+        x -= root + bit;
+        root = (root >> 1) + bit;
+      } else {
+        root >>= 1;
+      }
+    }
+    return value < 0 ? -(int16_t)root : (int16_t)root;
+  }
+
+  static void keyFor(int slot, char* key) {
+    key[0] = 't';
+    key[1] = '0' + slot / 10;
+    key[2] = '0' + slot % 10;
+    key[3] = '\0';
+  }
+
+  // Lengths align() and match() can index and divide by, terminated strings
+  static bool isValid(const Template& gesture) {
+    return gesture.length > 0 && gesture.length <= GestureConfig::MAX_TEMPLATE_FRAMES &&
+           gesture.energy > 0 &&
+           memchr(gesture.name, '\0', sizeof(gesture.name)) != nullptr &&
+           memchr(gesture.command, '\0', sizeof(gesture.command)) != nullptr;
+  }
+
+  void save(int slot) {
+    stored.version = STORED_VERSION;
+    stored.gesture = templates[slot];
+    Preferences preferences;
+    preferences.begin(GestureConfig::PREFERENCES_NAMESPACE, false);
+    char key[4];
+    keyFor(slot, key);
+    preferences.putBytes(key, &stored, sizeof(Stored));
+    preferences.end();
+  }
+
+  // Start the live window over (after a match or a recording)
+  void clearLive() {
+    liveCount = 0;
+    candidate = -1;
+  }
+
+  void record(const Frame& frame) {
+    bool active = norm(frame) >= GestureConfig::ACTIVE_FRAME;
+    if (recordState == RecordState::WAITING) {
+      if (!active) {
+        if (++waitFrames >= GestureConfig::RECORD_WAIT_FRAMES) {
+          Serial.println("❌ No gesture - recording cancelled");
+          recordState = RecordState::IDLE;
+        }
+        return;
+      }
+      recordState = RecordState::RECORDING;
+    }
+
+    recording.frames[recording.length++] = frame;
+    quietFrames = active ? 0 : quietFrames + 1;
+    if (quietFrames < GestureConfig::QUIET_FRAMES_TO_STOP &&
+        recording.length < GestureConfig::MAX_TEMPLATE_FRAMES) {
+      return;
+    }
+
+    // Done: drop the quiet tail
+    recordState = RecordState::IDLE;
+    recording.length -= quietFrames;
+    clearLive();
+    if (recording.length < GestureConfig::MIN_TEMPLATE_FRAMES) {
+      Serial.println("❌ Gesture too short - try again");
+      return;
+    }
+
+    recording.energy = 0;
+    for (int i = 0; i < recording.length; i++) recording.energy += norm(recording.frames[i]);
+    if (templates[recordSlot].length > 0) {
+      memcpy(recording.command, templates[recordSlot].command, sizeof(recording.command));
+    }
+    templates[recordSlot] = recording;
+    matchCounts[recordSlot] = 0;
+    save(recordSlot);
+    Serial.print("✋ Recorded ");
+    Serial.print(recording.name);
+    Serial.print(" (");
+    Serial.print(recording.length * 1000 / GestureConfig::FRAME_RATE_HZ);
+    Serial.println(" ms)");
+  }
+
+  // Best template for the newest frame. The standing candidate keeps its
+  // best cost so far as the bar; it fires once nothing (itself included) has
+  // beaten that for SETTLE_FRAMES
+  void match() {
+    framesMatched++;
+    int best = candidate;
+    int32_t bestCost = candidateCost;
+
+    for (int slot = 0; slot < GestureConfig::MAX_TEMPLATES; slot++) {
+      const Template& gesture = templates[slot];
+      if (gesture.length == 0) continue;
+
+      // Within the threshold, and strictly better than the best so far
+      // relative to energy: cost * bestEnergy < bestCost * energy
+      int32_t limit = (int32_t)((int64_t)gesture.energy * GestureConfig::MATCH_RATIO_Q8 / 256);
+      if (best >= 0) {
+        int64_t beating = ((int64_t)bestCost * gesture.energy - 1) / templates[best].energy;
+        limit = (int32_t)min((int64_t)limit, beating);
+      }
+      if (limit < 0) continue;
+
+      int32_t cost = align(slot, limit);
+      if (cost != NO_MATCH) {
+        best = slot;
+        bestCost = cost;
+      }
+    }
+
+    if (best != candidate || bestCost != candidateCost) {
+      candidate = best;
+      candidateCost = bestCost;
+      candidateAge = 0;
+      return;
+    }
+    if (candidate < 0 || ++candidateAge < GestureConfig::SETTLE_FRAMES) return;
+
+    int slot = candidate;
+    matchCounts[slot]++;
+    clearLive();
+    if (onGesture) onGesture(slot);
+  }
+};
+
+#endif // GESTURE_RECOGNIZER_H
@@ -0,0 +1,74 @@
+#ifndef RUNNING_WINDOW_H
+#define RUNNING_WINDOW_H
+
+#include <Arduino.h>
+
+// Last `Capacity` samples with their mean and variance, O(1) per push
+// Samples are stored as 16.16 fixed point (15 ug steps, a quarter of the
+// MPU-6050's finest LSB), so the running sum and sum of squares are exact
+// integers: adding the new sample and subtracting the evicted one never
+// drifts, and n * sum(x^2) - sum(x)^2 does not lose small wiggles around
+// 1 g the way it would in float. Values must stay within +-32 g (a
+// +-16 g reading on all three axes is 27.7 g).
+template <int Capacity>
+class RunningWindow {
+  static_assert(Capacity >= 1 && Capacity <= 1024, "RunningWindow holds 1 to 1024 samples");
+
+private:
+  static constexpr float ONE = 65536.0f;
+
+  int32_t samples[Capacity];
+  int next;                 // Slot the next push overwrites (the oldest)
+  int64_t sum;
+  int64_t sumSquares;
+
+  static int32_t toFixed(float value) {
+    return (int32_t)lroundf(value * ONE);
+  }
+
+public:
+  explicit RunningWindow(float initial = 0.0f) {
+    fill(initial);
+  }
+
+  // Every slot set to `value` (a window at rest)
+  void fill(float value) {
+    int32_t fixed = toFixed(value);
+    for (int i = 0; i < Capacity; i++) samples[i] = fixed;
+    next = 0;
+    sum = (int64_t)fixed * Capacity;
+    sumSquares = (int64_t)fixed * fixed * Capacity;
+  }
+
+  // Replace the oldest sample; returns the sample that left the window
+  float push(float value) {
+    int32_t added = toFixed(value);
+    int32_t evicted = samples[next];
+    samples[next] = added;
+    next = next + 1 < Capacity ? next + 1 : 0;
+
+    sum += added - evicted;
+    sumSquares += (int64_t)added * added - (int64_t)evicted * evicted;
+    return evicted / ONE;
+  }
+
+  float getMean() const {
+    return (float)sum / (ONE * Capacity);
+  }
+
+  // Population variance of the window
+  float getVariance() const {
+    int64_t spread = sumSquares * Capacity - sum * sum;   // n^2 * variance, exact
+    return (float)spread / ((float)Capacity * Capacity * ONE * ONE);
+  }
+
+  float getNewest() const {
+    return samples[next > 0 ? next - 1 : Capacity - 1] / ONE;
+  }
+
+  float getOldest() const { return samples[next] / ONE; }
+
+  static constexpr int capacity() { return Capacity; }
+};
+
+#endif // RUNNING_WINDOW_H